@@ -1,6 +1,11 @@
 #include "cobi.hpp"
+#include "cobsi.hpp"
+#include "cobmod.hpp"
 #include "cobarray.hpp"
+#include "cobbitarray.hpp"
+#include "coblut.hpp"
 #include "cobmatrix.hpp"
+#include "coblazyarray.hpp"
 
 #include <numeric>
 
@@ -38,6 +43,22 @@ void ints()
 
     static_assert(x != z);
 
+    constexpr cobint<0, 100> h = cobint<0, 100>::greatest();
+    constexpr auto hq = h / cobic<8>;
+    static_assert((hq.DD == 0) && (hq.GG == 12) && (hq.get() == 12));
+    constexpr auto hr = h % cobic<8>;
+    static_assert((hr.DD == 0) && (hr.GG == 7) && (hr.get() == 4));
+    constexpr auto hr3 = h % cobic<3>;
+    static_assert((hr3.GG == 2) && (hr3.get() == 1));
+    constexpr auto sr = cobint<-10, 10>::smallest() % cobic<3>;
+    static_assert((sr.DD == -2) && (sr.GG == 2) && (sr.get() == -1));
+    constexpr auto nr = cobint<0, 5>::greatest() % cobint<8, 9>{};
+    static_assert((nr.DD == 0) && (nr.GG == 5) && (nr.get() == 5));
+    constexpr auto mr = cobint<-50, -1>::smallest() % cobint<-7, -3>{};
+    static_assert((mr.DD == -6) && (mr.GG == 0) && (mr.get() == -1));
+    constexpr auto nq = cobint<-50, -1>::smallest() / cobic<4>;
+    static_assert((nq.DD == -12) && (nq.GG == 0) && (nq.get() == -12));
+
     using id = cobint<0,4>;
     auto o1 = id::be<std::optional>(2);
     assert(o1 && o1->get() == 2);
@@ -46,6 +67,98 @@ void ints()
 }
 
 
+void smallints()
+{
+    static_assert(sizeof(cobsi<int, 0, 200>) == 1);
+    static_assert(sizeof(cobsi<int, -5, 5>) == 1);
+    static_assert(sizeof(cobsi<int, 0, 256>) == 2);
+    static_assert(sizeof(cobsi<int, -40000, 0>) == 4);
+    static_assert(sizeof(cobsi<short, 0, 40>) == 1);
+    static_assert(sizeof(cobsi<char, 0, 40>) == 1);
+
+    cobsi<int, 0, 200> x;
+    assert(x.get() == 0);
+    x = cobic<200>;
+    cobint<0, 200> y = x;
+    assert(y == 200);
+    auto z = y + cobic<1>;
+    static_assert(z.GG == 201);
+    assert(x == cobic<200>);
+    assert(!x.be(201));
+    assert(x.be(7));
+
+    cobarray<cobsi<int, 0, 1000>, 3> a;
+    a.set(cobic<1>, cobic<999>);
+    cobint<0, 1000> w = a.get(cobic<1>);
+    assert(w == 999);
+}
+
+
+void rings()
+{
+    cobmod<5> x;
+    assert(x == cobic<0>);
+    --x;
+    assert(x == cobic<4>);
+    ++x;
+    assert(x == cobic<0>);
+    auto y = cobmod<5>{cobic<3>} + cobmod<5>{cobic<4>};
+    assert(y == cobic<2>);
+    assert(y - cobmod<5>{cobic<4>} == cobic<3>);
+    assert(cobmod<5>::wrap(-1) == cobic<4>);
+    assert(cobmod<5>::wrap(12u) == cobic<2>);
+
+    cobmod<8> z{cobic<7>};
+    ++z;
+    assert(z == cobic<0>);
+    assert(cobmod<8>::wrap(-1) == cobic<7>);
+    assert(cobmod<8>::wrap(21L) == cobic<5>);
+    cobint<0, 7> w = z - cobmod<8>{cobic<1>};
+    assert(w == 7);
+}
+
+
+void chars()
+{
+    using port = cobint<0, 65535>;
+    static_assert(port::max_chars == 5);
+    auto p = port::parse<std::optional>("8080");
+    assert(p && (*p == 8080));
+    assert(port::parse<std::optional>("0065535"));
+    assert(!port::parse<std::optional>("65536"));
+    assert(!port::parse<std::optional>("123456"));
+    assert(!port::parse<std::optional>("-1"));
+    assert(!port::parse<std::optional>("12a"));
+    assert(!port::parse<std::optional>(""));
+
+    using temp = cobint<-40, 125>;
+    static_assert(temp::max_chars == 4);
+    auto t = temp::parse<std::optional>("-40");
+    assert(t && (*t == -40));
+    assert(!temp::parse<std::optional>("-41"));
+    assert(!temp::parse<std::optional>("-"));
+
+    using wide = cobi<long long, std::numeric_limits<long long>::lowest(), 0>;
+    auto w = wide::parse<std::optional>("-9223372036854775808");
+    assert(w && (*w == std::numeric_limits<long long>::lowest()));
+    assert(!wide::parse<std::optional>("-9223372036854775809"));
+    using huge = cobi<unsigned long long, 0, std::numeric_limits<unsigned long long>::max() - 1>;
+    assert(!huge::parse<std::optional>("99999999999999999999"));
+    assert(!huge::parse<std::optional>("18446744073709551615"));
+    assert(huge::parse<std::optional>("18446744073709551614"));
+
+    char buf[temp::max_chars];
+    auto n = t->to_chars(buf);
+    assert(std::string_view(buf, n.get()) == "-40");
+    char wbuf[wide::max_chars];
+    auto wn = w->to_chars(wbuf);
+    assert(std::string_view(wbuf, wn.get()) == "-9223372036854775808");
+    char pbuf[port::max_chars];
+    auto pn = port{}.to_chars(pbuf);
+    assert(std::string_view(pbuf, pn.get()) == "0");
+}
+
+
 void intrange() 
 {
     //constexpr cobint<std::numeric_limits<int>::max()> x;
@@ -64,6 +177,24 @@ void intrange()
     auto a = std::accumulate(z.range().begin(), z.range().end(), 0);
     assert(s == a);
 
+    int u = 0;
+    cob_for<cobint<0, 5>>([&](auto i) {
+        static_assert(i.DD == i.GG);
+        u += i.get();
+    });
+    assert(u == s);
+
+    using hundred = cobint<1, 100>;
+    int w = 0;
+    bool all = cob_for<hundred>([&](hundred i) {
+        w += i.get();
+        return i < 10;
+    });
+    assert(!all && (w == 55));
+    w = 0;
+    all = cob_for<hundred>([&](auto i) { w += i.get(); });
+    assert(all && (w == 5050));
+
 }
 
 
@@ -99,6 +230,43 @@ void arrays()
 }
 
 
+void many()
+{
+    int raw[200];
+    for (int i = 0; i < 200; ++i) {
+        raw[i] = i % 10;
+    }
+    cobarray<cobint<0, 9>, 200> a;
+    assert(be_many(a, raw) == 200);
+    assert(a.get(cobic<199>) == 9);
+
+    raw[150] = 10;
+    assert(be_many(a, raw) == 150);
+    raw[3] = -1;
+    assert(be_many(a, raw) == 3);
+    using digit = cobint<0, 9>;
+    auto n = be_many<std::optional, digit>(raw);
+    assert(!n.has_value());
+    raw[3] = 3;
+    raw[150] = 0;
+    auto o = be_many<std::optional, digit>(raw);
+    assert(o.has_value() && (o->get(cobic<13>) == 3));
+
+    signed char small[3] = { 3, 5, 4 };
+    cobarray<cobi<signed char, 4, 5>, 3> b;
+    assert(be_many(b, small) == 0);
+
+    cobspan<int const, 200> s{raw};
+    assert(be_many(a, s) == 200);
+    assert(be_many(a, cobspan<int, 200>{raw}) == 200);
+    raw[70] = 11;
+    assert(be_many(a, s) == 70);
+    assert(a.get(cobic<69>) == 9);
+    auto p = be_many<std::optional, digit>(s);
+    assert(!p.has_value());
+}
+
+
 void arrange()
 {
     cobarray<int, 4> a;
@@ -115,6 +283,69 @@ void arrange()
 }
 
 
+void bitarrays()
+{
+    using state = cobint<0, 5>;
+    cobbitarray<state, 100> b;
+    static_assert(b.bits == 3);
+    static_assert(sizeof b <= 6 * 8);
+    assert(b.get(cobic<42>) == 0);
+
+    for (auto i: b.irange()) {
+        state s;
+        s.be(i.get() % 6);
+        b.set(i, s);
+    }
+    assert(b.get(cobic<21>) == 3);
+    assert(b.get(cobic<99>) == 3);
+    assert(!b.maybe_set(100, cobic<1>));
+
+    cobarray<state, 100> a;
+    b.unpack(a);
+    for (auto i: a.irange()) {
+        assert(a.get(i) == i.get() % 6);
+    }
+
+    cobbitarray<cobint<-3, 12>, 9> c;
+    static_assert(c.bits == 4);
+    c.fill(cobic<-3>);
+    c.set(cobic<8>, cobic<12>);
+    cobarray<cobint<-3, 12>, 9> d;
+    c.unpack(d);
+    assert(d.get(cobic<0>) == -3);
+    assert(d.get(cobic<8>) == 12);
+}
+
+
+struct square {
+    constexpr int operator()(cobint<-3, 3> i) const { return i.get() * i.get(); }
+};
+
+struct hexdigit {
+    constexpr char operator()(cobi<unsigned char, 0, 15> i) const
+    {
+        return "0123456789abcdef"[i.get()];
+    }
+};
+
+void luts()
+{
+    using sq = coblut<square, cobint<-3, 3>>;
+    static_assert(sq::get(cobic<-3>) == 9);
+    static_assert(sq::get(cobic<2>) == 4);
+    cobint<-3, 3> i;
+    [[maybe_unused]] bool const in = i.be(-1);
+    assert(in);
+    assert(sq{}(i) == 1);
+
+    using nibble = cobi<unsigned char, 0, 15>;
+    nibble h;
+    h.be(12);
+    using hex = coblut<hexdigit, nibble>;
+    assert(hex::get(h) == 'c');
+}
+
+
 void matrix()
 {
     std::cout << "\nEnter the Matrix\n";
@@ -150,13 +381,245 @@ void matrix()
 }
 
 
+void matrix_views()
+{
+    static cobmatrix<int, 50, 40> m;
+    int n = 0;
+    for (auto& x: m) {
+        x = (n++ * 7919) % 2000;
+    }
+    auto b = m.begin();
+    assert((m.end() - b) == 2000);
+    assert(((b + 45) - b) == 45);
+    assert(*(b + 45) == m.get({cobic<1>, cobic<5>}));
+    assert(((b + 45) - 5) == (b + 40));
+    assert((b + 2001) == m.end());
+    std::nth_element(m.begin(), m.begin() + 1000, m.end());
+    assert(*(m.begin() + 1000) == 1000);
+    std::sort(m.begin(), m.end());
+    assert(std::is_sorted(m.begin(), m.end()));
+    assert(std::lower_bound(m.begin(), m.end(), 1234) - m.begin() == 1234);
+    assert(m.get({cobic<49>, cobic<39>}) == 1999);
+
+    auto r = m.row_view(cobic<2>);
+    assert(r[cobic<0>] == 80);
+    auto c = m.column_view(cobic<3>);
+    static_assert(decltype(c)::size() == 50);
+    assert(c[cobic<0>] == 3);
+    assert(c[cobic<49>] == 49 * 40 + 3);
+    assert(std::accumulate(c.begin(), c.end(), 0) == 50 * 3 + 40 * (49 * 50 / 2));
+    c.set(cobic<1>, -1);
+    assert(m.get({cobic<1>, cobic<3>}) == -1);
+    cobmatrix<int, 50, 40> const& k = m;
+    assert(k.column_view(cobic<3>).get(cobic<1>) == -1);
+    assert(*(k.begin() + 43) == -1);
+}
+
+
+template <class L> void matrix_layout()
+{
+    static cobmatrix<int, 8, 12, L> m;
+    for (auto i: cobirange<int, 0, 7>{}) {
+        for (auto j: cobirange<int, 0, 11>{}) {
+            m.set({i, j}, i.get() * 100 + j.get());
+        }
+    }
+    for (auto i: cobirange<int, 0, 7>{}) {
+        for (auto j: cobirange<int, 0, 11>{}) {
+            assert(m.get({i, j}) == i.get() * 100 + j.get());
+            assert(m.span().data()[m.at({i, j})] == i.get() * 100 + j.get());
+        }
+    }
+    int seen = 0;
+    for (auto x: m) {
+        seen += x;
+    }
+    assert(seen == 12 * (100 * 28) + 8 * 66);
+    assert(m.maybe_set(7, 11, -1));
+    assert(m.get({cobic<7>, cobic<11>}) == -1);
+}
+
+
+void matrix_layouts()
+{
+    static_assert(sizeof(cobmatrix<int, 100, 100>) == (100 * 100 + 1) * sizeof(int));
+
+    matrix_layout<cobrowmajor>();
+    matrix_layout<cobcolmajor>();
+    matrix_layout<cobtiled<4>>();
+
+    static_assert(cobmatrix<int, 8, 8, cobtiled<4>>::at({cobic<0>, cobic<4>}) == 16);
+    static_assert(cobmatrix<int, 8, 8, cobtiled<4>>::at({cobic<1>, cobic<1>}) == 5);
+    static_assert(cobmatrix<int, 8, 8, cobcolmajor>::at({cobic<1>, cobic<0>}) == 1);
+
+    cobmatrix<int, 3, 4, cobcolmajor> c;
+    c.fill(0);
+    auto col = c.column_view(cobic<2>);
+    static_assert(std::is_same_v<decltype(col), cobspan<int, 3>>);
+    col.set(cobic<1>, 5);
+    assert(c.get({cobic<1>, cobic<2>}) == 5);
+    auto r = c.row_view(cobic<1>);
+    static_assert(std::is_same_v<decltype(r), cobstride<int, 4, 3>>);
+    assert(r[cobic<2>] == 5);
+    cobarray<int, 4> a;
+    a.fill(9);
+    c.assign(cobic<0>, a.span());
+    assert(c.get({cobic<0>, cobic<3>}) == 9);
+    assert(c.get({cobic<1>, cobic<3>}) == 0);
+}
+
+
+void spans()
+{
+    cobarray<int, 8> a;
+    for (auto i: a.irange()) {
+        a.set(i, i.get());
+    }
+    auto s = a.span();
+    static_assert(decltype(s)::size() == 8);
+    assert(std::accumulate(s.begin(), s.end(), 0) == 28);
+    s.set(cobic<7>, 70);
+    assert(a.get(cobic<7>) == 70);
+    assert(s[cobic<1>] == 1);
+
+    cobint<0, 4> from{cobic<2>};
+    auto t = a.span<4>(from);
+    static_assert(decltype(t)::size() == 4);
+    assert(t.get(cobic<0>) == 2);
+    assert(t.get(cobic<3>) == 5);
+    // a.span<5>(from); // Won't compile, might end after the array
+
+    cobarray<int, 8> const& c = a;
+    cobspan<int const, 8> cs = c.span();
+    cobspan<int const, 8> ms = s;
+    assert(cs.data() == ms.data());
+
+    cobmatrix<int, 3, 4> m;
+    m.fill(1);
+    auto r = m.span(cobic<2>);
+    std::fill(r.begin(), r.end(), 7);
+    assert(m.get({cobic<1>, cobic<3>}) == 1);
+    assert(m.get({cobic<2>, cobic<0>}) == 7);
+    assert(m.get({cobic<2>, cobic<3>}) == 7);
+}
+
+
+// Equal if the keys are, whatever the hits
+struct keyed {
+    int key;
+    int hits;
+    bool operator==(keyed const& x) const { return key == x.key; }
+    bool operator!=(keyed const& x) const { return key != x.key; }
+};
+
+void bulk()
+{
+    cobarray<int, 100> a;
+    a.fill(3);
+    cobarray<int, 100> b;
+    b.copy_from(a);
+    assert(!(a != b));
+    b.set(cobic<99>, 4);
+    assert(a != b);
+    b.assign(a.span());
+    assert(!(a != b));
+
+    cobarray<char, 10> c;
+    c.fill('c');
+    assert(c.get(cobic<9>) == 'c');
+
+    cobarray<double, 4> f;
+    f.fill(0.0);
+    cobarray<double, 4> g;
+    g.fill(-0.0);
+    assert(!(f != g));
+
+    cobarray<keyed, 8> h;
+    h.fill({ 1, 0 });
+    cobarray<keyed, 8> k;
+    k.fill({ 1, 5 });
+    assert(!(h != k));
+    k.set(cobic<7>, { 2, 5 });
+    assert(h != k);
+
+    cobarray<cobsi<int, 0, 9>, 5> si;
+    si.fill(cobsi<int, 0, 9>{ cobic<4> });
+    cobarray<cobsi<int, 0, 9>, 5> sj;
+    sj.copy_from(si);
+    assert(!(si != sj));
+
+    cobmatrix<int, 3, 4> m;
+    m.fill(5);
+    cobmatrix<int, 3, 4> n;
+    n.copy_from(m);
+    assert(!(m != n));
+    n.assign(cobic<1>, a.span<4>(cobic<0>));
+    assert(m != n);
+    assert(n.get({cobic<1>, cobic<0>}) == 3);
+    assert(n.get({cobic<2>, cobic<0>}) == 5);
+}
+
+
+struct counted {
+    static int alive;
+    int v = 7;
+    counted() { ++alive; }
+    counted(counted const& x) : v(x.v) { ++alive; }
+    counted& operator=(counted const&) = default;
+    ~counted() { --alive; }
+};
+int counted::alive = 0;
+
+void lazy()
+{
+    {
+        coblazyarray<counted, 1000> a;
+        assert(counted::alive == 0);
+        assert(a.built() == cobic<0>);
+        assert(a.get(cobic<500>).v == 7);
+
+        counted c;
+        c.v = 3;
+        a.set(cobic<2>, c);
+        assert(a.built() == cobic<3>);
+        assert(counted::alive == 4);
+        assert(a.get(cobic<2>).v == 3);
+        assert(a.get(cobic<1>).v == 7);
+
+        a.grab(cobic<9>)->v = 9;
+        assert(a.built() == cobic<10>);
+        assert(a.get(cobic<9>).v == 9);
+        a.set(cobic<1>, c);
+        assert(a.built() == cobic<10>);
+        assert(!a.maybe_set(1000, c));
+    }
+    assert(counted::alive == 0);
+
+    coblazyarray<int, 10> b;
+    b.set(cobic<5>, 5);
+    assert(b.get(cobic<4>) == 0);
+    assert(b.get(cobic<5>) == 5);
+}
+
+
 int main()
 {
     ints();
+    smallints();
+    rings();
+    chars();
     intrange();
     arrays();
+    many();
     arrange();
+    bitarrays();
+    luts();
     matrix();
+    matrix_views();
+    matrix_layouts();
+    spans();
+    bulk();
+    lazy();
 
     return 0;
 }
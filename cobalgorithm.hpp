@@ -0,0 +1,102 @@
+/* Algorithms over compile time bound arrays. For documentation, see
+ * README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBALGORITHM)
+#define INC_COBALGORITHM
+
+
+#include "cobarray.hpp"
+
+#include <functional>
+
+
+namespace cobhlp {
+// The value of an element, as a plain number, so loops over them vectorize
+template <class T> constexpr std::enable_if_t<std::is_arithmetic_v<T>, T> raw(T x) { return x; }
+template <class T, T D, T G> constexpr T raw(cobi<T, D, G> x) { return x.get(); }
+
+template <class E> using raw_t = decltype(raw(std::declval<E>()));
+
+// Position of the first `x` in `p[0..n)`, or `n`. Looks a block at a time,
+// without branching, and only looks closer into the block that has it.
+template <class E, class V> constexpr int find(E const* p, int n, V x)
+{
+    constexpr int block = 64;
+    int k = 0;
+    for (; k + block <= n; k += block) {
+        unsigned hit = 0;
+        for (int j = 0; j < block; ++j) {
+            hit |= (raw(p[k + j]) == x);
+        }
+        if (hit) {
+            break;
+        }
+    }
+    for (; k < n; ++k) {
+        if (raw(p[k]) == x) {
+            return k;
+        }
+    }
+    return n;
+}
+
+// Smallest (`L` is `std::less`) or greatest (`std::greater`) of `p[0..N)`
+template <class L, int N, class E> constexpr raw_t<E> extreme(E const* p)
+{
+    auto m = raw(p[0]);
+    for (int k = 1; k < N; ++k) {
+        auto const x = raw(p[k]);
+        m = L{}(x, m) ? x : m;
+    }
+    return m;
+}
+} // namespace cobhlp
+
+
+// Position of the first element equal to `x`, `N` if there's none
+template <class E, int N> cobint<0, N> cob_find(cobarray<E, N> const& a, E const& x)
+{
+    cobint<0, N> rslt;
+    rslt.be(cobhlp::find(a.span().data(), N, cobhlp::raw(x)));
+    return rslt;
+}
+
+// Number of elements equal to `x`
+template <class E, int N> cobint<0, N> cob_count(cobarray<E, N> const& a, E const& x)
+{
+    auto const p = a.span().data();
+    auto const v = cobhlp::raw(x);
+    int n = 0;
+    for (int k = 0; k < N; ++k) {
+        n += (cobhlp::raw(p[k]) == v);
+    }
+    cobint<0, N> rslt;
+    rslt.be(n);
+    return rslt;
+}
+
+// Position of the first of the smallest elements. This is two passes, one
+// to find the smallest value, the other to find where it is, as both
+// vectorize, unlike a single pass that tracks the position.
+template <class E, int N> typename cobarray<E, N>::index cob_min(cobarray<E, N> const& a)
+{
+    auto const p = a.span().data();
+    typename cobarray<E, N>::index rslt;
+    rslt.be(cobhlp::find(p, N, cobhlp::extreme<std::less<>, N>(p)));
+    return rslt;
+}
+
+// Position of the first of the greatest elements, like `cob_min()`
+template <class E, int N> typename cobarray<E, N>::index cob_max(cobarray<E, N> const& a)
+{
+    auto const p = a.span().data();
+    typename cobarray<E, N>::index rslt;
+    rslt.be(cobhlp::find(p, N, cobhlp::extreme<std::greater<>, N>(p)));
+    return rslt;
+}
+
+
+#endif // !defined(INC_COBALGORITHM)
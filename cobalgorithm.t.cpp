@@ -0,0 +1,75 @@
+#include "cobalgorithm.hpp"
+
+#include <cassert>
+
+
+void find()
+{
+    static cobarray<int, 1000> a;
+    for (auto i: a.irange()) {
+        a.set(i, i.get() % 300);
+    }
+    assert(cob_find(a, 299) == cobic<299>);
+    assert(cob_find(a, 0) == cobic<0>);
+    assert(cob_find(a, 300) == cobic<1000>);
+    a.set(cobic<999>, 1234);
+    assert(cob_find(a, 1234) == cobic<999>);
+
+    cobarray<cobint<0, 9>, 100> b;
+    b.fill(cobic<1>);
+    b.set(cobic<70>, cobic<9>);
+    assert(cob_find(b, cobint<0, 9>{ cobic<9> }) == cobic<70>);
+}
+
+
+void count()
+{
+    static cobarray<short, 1000> a;
+    for (auto i: a.irange()) {
+        a.set(i, static_cast<short>(i.get() % 10));
+    }
+    assert(cob_count(a, short{ 3 }) == cobic<100>);
+    assert(cob_count(a, short{ 10 }) == cobic<0>);
+
+    cobarray<cobint<0, 9>, 10> b;
+    b.fill(cobic<4>);
+    assert(cob_count(b, cobint<0, 9>{ cobic<4> }) == cobic<10>);
+}
+
+
+void minmax()
+{
+    static cobarray<int, 1000> a;
+    for (auto i: a.irange()) {
+        a.set(i, (i.get() * 37) % 1000);
+    }
+    auto mn = cob_min(a);
+    assert(a.get(mn) == 0);
+    assert(mn == cobic<0>);
+    auto mx = cob_max(a);
+    assert(a.get(mx) == 999);
+
+    cobarray<float, 7> f;
+    f.fill(1.0f);
+    f.set(cobic<2>, -3.0f);
+    f.set(cobic<5>, -3.0f);
+    f.set(cobic<6>, 8.0f);
+    assert(cob_min(f) == cobic<2>);
+    assert(cob_max(f) == cobic<6>);
+
+    cobarray<cobint<-5, 5>, 3> c;
+    c.fill(cobic<0>);
+    c.set(cobic<1>, cobic<5>);
+    assert(cob_max(c) == cobic<1>);
+    assert(cob_min(c) == cobic<0>);
+}
+
+
+int main()
+{
+    find();
+    count();
+    minmax();
+
+    return 0;
+}
@@ -8,6 +8,8 @@
 
 
 #include "cobi.hpp"
+#include "cobhlp.hpp"
+#include "cobspan.hpp"
 
 
 template <class T, int N>
@@ -61,14 +63,18 @@ struct cobarray {
     }
 
     void fill(T const& v) {
-        for (T* p = d; p < d + N; ++p) {
-            *p = v;
-        }
+        cobhlp::fill(d, N, v);
+    }
+
+    bool operator!=(cobarray const& x) const {
+        return !cobhlp::equal(d, x.d, N);
     }
 
-    constexpr bool operator!=(cobarray const& x) {
-        auto [i, j] = std::mismatch(begin(), end(), x.begin());
-	return i != end();
+    void copy_from(cobarray const& x) {
+        cobhlp::copy(d, x.d, N);
+    }
+    void assign(cobspan<T const, N> x) {
+        cobhlp::copy(d, x.data(), N);
     }
 
     class I {
@@ -223,8 +229,100 @@ struct cobarray {
 
     constexpr cobirange<int,0,N-1> irange() { return cobirange<int,0,N-1>{}; }
 
+    constexpr cobspan<T, N> span() { return cobspan<T, N>::at(&d[0]); }
+    constexpr cobspan<T const, N> span() const { return cobspan<T const, N>::at(&d[0]); }
+    template <int L, int K, int G> constexpr cobspan<T, L> span(cobi<int, K, G> from) {
+        return span().template sub<L>(from);
+    }
+    template <int L, int K, int G> constexpr cobspan<T const, L> span(cobi<int, K, G> from) const {
+        return span().template sub<L>(from);
+    }
+
 private:
     T d[N+1];
 };
 
+
+namespace cobhlp {
+
+// Puts values that were already range checked (in bulk) into bound
+// integers, without checking them again. It's a plain copy, as `cobi` is
+// just its `T`, so it's vectorized even when compilers can't prove that
+// `to` and `x` don't overlap.
+template <class T, T D, T G>
+void put_checked(cobi<T, D, G>* to, T const* x, int n)
+{
+    static_assert(sizeof(cobi<T, D, G>) == sizeof(T));
+    static_assert(std::is_trivially_copyable_v<cobi<T, D, G>>);
+    std::memcpy(static_cast<void*>(to), x, n * sizeof(T));
+}
+
+template <class T, T D, T G, int N>
+cobint<0, N> be_many(cobi<T, D, G>* to, T const* x)
+{
+    using U = std::make_unsigned_t<T>;
+    constexpr int block = 64;
+    constexpr U   span  = static_cast<U>(G) - static_cast<U>(D);
+    int k = 0;
+    for (; k + block <= N; k += block) {
+        U out = 0;
+        for (int j = k; j < k + block; ++j) {
+            out |= static_cast<U>(static_cast<U>(x[j]) - static_cast<U>(D)) > span;
+        }
+        if (out) {
+            break;
+        }
+        put_checked(to + k, x + k, block);
+    }
+    cobint<0, N> rslt = cobint<0, N>::greatest();
+    for (; k < N; ++k) {
+        if (!to[k].be(x[k])) {
+            rslt.be(k);
+            break;
+        }
+    }
+    return rslt;
+}
+
+}
+
+
+// Range checks all of `x` at once and puts them in `a`, up to the first one
+// that is out of range, whose position is returned (`N` if all are in range).
+// Checks are done a block at a time, without branching, so compilers can
+// vectorize them. Only a block that has a value out of range is looked into.
+template <class T, T D, T G, int N>
+cobint<0, N> be_many(cobarray<cobi<T, D, G>, N>& a, T const (&x)[N])
+{
+    return cobhlp::be_many<T, D, G, N>(a.span().data(), x);
+}
+
+template <class T, T D, T G, int N, class S>
+std::enable_if_t<std::is_same_v<std::remove_const_t<S>, T>, cobint<0, N>>
+be_many(cobarray<cobi<T, D, G>, N>& a, cobspan<S, N> x)
+{
+    return cobhlp::be_many<T, D, G, N>(a.span().data(), x.data());
+}
+
+// Same as above, but gives the whole array only if all of `x` are in range
+template <template <class> class V, class C, int N, class T>
+V<cobarray<C, N>> be_many(T const (&x)[N])
+{
+    cobarray<C, N> rslt;
+    if (be_many(rslt, x) == N) {
+        return rslt;
+    }
+    return {};
+}
+
+template <template <class> class V, class C, int N, class T>
+V<cobarray<C, N>> be_many(cobspan<T, N> x)
+{
+    cobarray<C, N> rslt;
+    if (be_many(rslt, x) == N) {
+        return rslt;
+    }
+    return {};
+}
+
 #endif // define      INC_COBARRAY
@@ -0,0 +1,120 @@
+/* Compile time bound atomic integers. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBATOMIC)
+#define INC_COBATOMIC
+
+
+#include "cobi.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+
+template <class T, T D, T G = D> class cobatomic {
+    static_assert(std::atomic<T>::is_always_lock_free, "T must be lock-free");
+
+    std::atomic<T> v;
+
+public:
+    using value_type = cobi<T, D, G>;
+
+    constexpr cobatomic()
+        : v(D)
+    {
+    }
+    constexpr cobatomic(value_type x)
+        : v(x.get())
+    {
+    }
+
+    cobatomic(cobatomic const&) = delete;
+    cobatomic& operator=(cobatomic const&) = delete;
+
+    value_type load(std::memory_order o = std::memory_order_seq_cst) const
+    {
+        return cooked(v.load(o));
+    }
+    void store(value_type x, std::memory_order o = std::memory_order_seq_cst)
+    {
+        v.store(x.get(), o);
+    }
+    value_type exchange(value_type x, std::memory_order o = std::memory_order_seq_cst)
+    {
+        return cooked(v.exchange(x.get(), o));
+    }
+
+    // Adds `x`, unless that would go out of [D, G], in which case nothing
+    // changes and an empty `V` is returned. Otherwise, returns the new value.
+    template <template <class> class V, T D2, T G2>
+    V<value_type> try_add(cobi<T, D2, G2> x, std::memory_order o = std::memory_order_seq_cst)
+    {
+        return update<V>([x](T c, T& n) { return step(c, x.get(), n); }, o);
+    }
+    template <template <class> class V, T D2, T G2>
+    V<value_type> try_sub(cobi<T, D2, G2> x, std::memory_order o = std::memory_order_seq_cst)
+    {
+        return update<V>([x](T c, T& n) { return step(c, x.get(), n, true); }, o);
+    }
+
+    // Like `cobi::advance()` and `cobi::ebb()`, but atomic
+    bool try_advance(std::memory_order o = std::memory_order_seq_cst)
+    {
+        return update<flag>([](T c, T& n) { return step(c, T{1}, n); }, o).has;
+    }
+    bool try_ebb(std::memory_order o = std::memory_order_seq_cst)
+    {
+        return update<flag>([](T c, T& n) { return step(c, T{1}, n, true); }, o).has;
+    }
+
+private:
+    template <class U> struct flag {
+        flag() {}
+        flag(U const&) : has(true) {}
+        bool has = false;
+    };
+
+    static value_type cooked(T x)
+    {
+        value_type rslt;
+        rslt.be(x);
+        return rslt;
+    }
+
+    // Puts `c` moved by `x` (up, or down if `down`) in `n`, if that's in
+    // [D, G]. It's done on raw (unsigned) integers, as a `cobi` of `-x`
+    // can't be had for unsigned `T`, nor can `c - D` overflow here.
+    static bool step(T c, T x, T& n, bool down = false)
+    {
+        using U = std::make_unsigned_t<T>;
+        bool const back = down != (x < 0);
+        U const dist = (x < 0) ? U(0) - static_cast<U>(x) : static_cast<U>(x);
+        U const room = back ? static_cast<U>(c) - static_cast<U>(D) : static_cast<U>(G) - static_cast<U>(c);
+        if (dist > room) {
+            return false;
+        }
+        n = static_cast<T>(back ? static_cast<U>(c) - dist : static_cast<U>(c) + dist);
+        return true;
+    }
+
+    // There's no `fetch_add()` that doesn't, at least for a moment, go out
+    // of range, so it's always a CAS loop.
+    template <template <class> class V, class F> V<value_type> update(F f, std::memory_order o)
+    {
+        T cur = v.load(std::memory_order_relaxed);
+        for (;;) {
+            T n;
+            if (!f(cur, n)) {
+                return {};
+            }
+            if (v.compare_exchange_weak(cur, n, o, std::memory_order_relaxed)) {
+                return cooked(n);
+            }
+        }
+    }
+};
+
+
+#endif // !defined(INC_COBATOMIC)
@@ -0,0 +1,88 @@
+#include "cobatomic.hpp"
+
+#include <optional>
+#include <thread>
+#include <vector>
+#include <cassert>
+
+
+void basic()
+{
+    cobatomic<int, 0, 10> a;
+    assert(a.load() == 0);
+    assert(!a.try_ebb());
+    assert(a.try_advance());
+    auto x = a.try_add<std::optional>(cobic<9>);
+    assert(x.has_value() && (*x == 10));
+    assert(!a.try_advance());
+    assert(!a.try_add<std::optional>(cobint<1, 3>::greatest()).has_value());
+    assert(a.load() == 10);
+    auto y = a.try_sub<std::optional>(cobic<4>);
+    assert(y.has_value() && (*y == 6));
+    assert(a.exchange(cobic<2>) == 6);
+    a.store(cobic<7>);
+    assert(a.load() == 7);
+}
+
+
+void unsigned_slots()
+{
+    cobatomic<unsigned, 0, 10> a;
+    assert(!a.try_ebb());
+    assert(a.try_advance());
+    assert(a.try_ebb());
+    assert(a.load() == 0u);
+    assert(!a.try_sub<std::optional>(cobi<unsigned, 1>{}).has_value());
+    auto x = a.try_add<std::optional>(cobi<unsigned, 10>{});
+    assert(x.has_value() && (*x == 10u));
+    auto y = a.try_sub<std::optional>(cobi<unsigned, 3, 4>::greatest());
+    assert(y.has_value() && (*y == 6u));
+    assert(!a.try_sub<std::optional>(cobi<unsigned, 7>{}).has_value());
+    assert(a.load() == 6u);
+
+    cobatomic<int, -5, 5> b;
+    assert(b.load() == -5);
+    auto z = b.try_sub<std::optional>(cobic<-10>);
+    assert(z.has_value() && (*z == 5));
+    assert(!b.try_add<std::optional>(cobint<1, 2>::smallest()).has_value());
+    auto w = b.try_add<std::optional>(cobic<-10>);
+    assert(w.has_value() && (*w == -5));
+    assert(!b.try_sub<std::optional>(cobic<1>).has_value());
+}
+
+
+void contended()
+{
+    constexpr int capacity = 1000;
+    cobatomic<int, 0, capacity> used;
+    std::vector<std::thread> threads;
+    std::vector<int> taken(8);
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&used, &taken, t] {
+            for (int i = 0; i < capacity; ++i) {
+                if (used.try_advance()) {
+                    ++taken[t];
+                }
+            }
+        });
+    }
+    for (auto& t: threads) {
+        t.join();
+    }
+    int total = 0;
+    for (auto n: taken) {
+        total += n;
+    }
+    assert(total == capacity);
+    assert(used.load() == capacity);
+}
+
+
+int main()
+{
+    basic();
+    unsigned_slots();
+    contended();
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/* Compile time bound arrays of bound integers, packed to as few bits as the
+ * bounds allow. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBBITARRAY)
+#define INC_COBBITARRAY
+
+
+#include "cobarray.hpp"
+#include "cobhlp.hpp"
+
+#include <cstdint>
+
+
+template <class E, int N> struct cobbitarray;
+
+template <class T, T D, T G, int N> struct cobbitarray<cobi<T, D, G>, N> {
+    static_assert(N > 0, "Array must have at least one element");
+
+    using value_type = cobi<T, D, G>;
+    using index      = cobi<int, 0, N - 1>;
+
+    static constexpr unsigned bits = std::max(
+        cobhlp::bitwidth(static_cast<std::uintmax_t>(G) - static_cast<std::uintmax_t>(D)), 1U);
+    static_assert(bits < 64, "Range too wide to pack");
+
+    constexpr cobbitarray()
+        : w{}
+    {
+    }
+
+    constexpr bool     empty() const noexcept { return false; }
+    constexpr unsigned size() const noexcept { return N; }
+    constexpr unsigned max_size() const noexcept { return N; }
+
+    constexpr value_type get(index i) const { return at(static_cast<std::size_t>(i.get()) * bits); }
+    constexpr value_type set(index i, value_type v)
+    {
+        std::size_t const  p   = static_cast<std::size_t>(i.get()) * bits;
+        std::size_t const  k   = p / 64;
+        unsigned const     off = p % 64;
+        std::uint64_t const x  = raw(v);
+        w[k] = (w[k] & ~(mask << off)) | (x << off);
+        if (off + bits > 64) {
+            w[k + 1] = (w[k + 1] & ~(mask >> (64 - off))) | (x >> (64 - off));
+        }
+        return v;
+    }
+
+    constexpr bool maybe_set(int i, value_type v)
+    {
+        index idx;
+        if (idx.be(i)) {
+            set(idx, v);
+            return true;
+        }
+        return false;
+    }
+
+    void fill(value_type v)
+    {
+        for (auto i : irange()) {
+            set(i, v);
+        }
+    }
+
+    // Unpacks all elements at once, which is much faster than one by one
+    void unpack(cobarray<value_type, N>& a) const
+    {
+        if constexpr (64 % bits == 0) {
+            constexpr int per = 64 / bits;
+            for (int j = 0; j * per < N; ++j) {
+                std::uint64_t x = w[j];
+                for (int k = j * per; k < std::min(N, (j + 1) * per); ++k) {
+                    index i;
+                    i.be(k);
+                    a.set(i, cooked(x & mask));
+                    x >>= bits;
+                }
+            }
+        }
+        else {
+            std::size_t p = 0;
+            for (auto i : irange()) {
+                a.set(i, at(p));
+                p += bits;
+            }
+        }
+    }
+
+    void pack(cobarray<value_type, N> const& a)
+    {
+        for (auto i : irange()) {
+            set(i, a.get(i));
+        }
+    }
+
+    constexpr cobirange<int, 0, N - 1> irange() const { return cobirange<int, 0, N - 1>{}; }
+
+private:
+    static constexpr std::uint64_t mask = (std::uint64_t{ 1 } << bits) - 1;
+    static constexpr std::size_t   words = (static_cast<std::size_t>(N) * bits + 63) / 64;
+
+    static constexpr std::uint64_t raw(value_type v)
+    {
+        return static_cast<std::uintmax_t>(v.get()) - static_cast<std::uintmax_t>(D);
+    }
+    static constexpr value_type cooked(std::uint64_t x)
+    {
+        value_type rslt;
+        rslt.be(static_cast<T>(static_cast<std::uintmax_t>(D) + x));
+        return rslt;
+    }
+    constexpr value_type at(std::size_t p) const
+    {
+        std::size_t const k   = p / 64;
+        unsigned const    off = p % 64;
+        return cooked(((w[k] >> off) | ((w[k + 1] << 1) << (63 - off))) & mask);
+    }
+
+    // One more word, so that reading the last element never goes out
+    std::uint64_t w[words + 1];
+};
+
+#endif // !defined(INC_COBBITARRAY)
@@ -0,0 +1,225 @@
+/* Tracking writes to compile time bound arrays. For documentation, see
+ * README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBDIRTY)
+#define INC_COBDIRTY
+
+
+#include "cobarray.hpp"
+#include "cobhlp.hpp"
+#include "cobmatrix.hpp"
+
+#include <cstdint>
+#include <utility>
+
+
+namespace cobhlp {
+// How `cobdirty` sees a container: as `size` elements, one after the other
+template <class C> struct flat;
+template <class T, int N> struct flat<cobarray<T, N>> {
+    using value_type = T;
+    using index = typename cobarray<T, N>::index;
+    static constexpr int size = N;
+    static constexpr int at(index i) { return i.get(); }
+    static constexpr bool be(index& i, int k) { return i.be(k); }
+};
+template <class T, int M, int N, class L> struct flat<cobmatrix<T, M, N, L>> {
+    using value_type = T;
+    using index = typename cobmatrix<T, M, N, L>::index;
+    static constexpr int size = M * N;
+    static constexpr int at(index i) { return cobmatrix<T, M, N, L>::at(i); }
+    static constexpr bool be(index& i, int m, int n) { return i.irow.be(m) && i.icolumn.be(n); }
+};
+} // namespace cobhlp
+
+
+// A `cobarray` or `cobmatrix` (`C`) that remembers which blocks of `B`
+// elements were written to since `clear_dirty()`. Reading is done as for
+// `C`, writing through its setters (and `grab()`) marks the block dirty.
+// If `B` doesn't divide the size of `C`, the last block is shorter.
+template <class C, int B = 64> class cobdirty {
+    using flat = cobhlp::flat<C>;
+    using T    = typename flat::value_type;
+
+    static_assert(B > 0, "Blocks must have at least one element");
+
+    static constexpr int whole  = flat::size / B;
+    static constexpr int rest   = flat::size % B;
+    static constexpr int blocks = whole + (rest > 0);
+    static constexpr int words  = (blocks + 63) / 64;
+
+public:
+    using value_type = T;
+    using index      = typename flat::index;
+    using block      = cobi<int, 0, blocks - 1>;
+    // A block of all `B` elements, that is, any but a shorter last one
+    using full = cobi<int, 0, ((whole > 0) ? whole : 1) - 1>;
+
+    constexpr bool     empty() const noexcept { return false; }
+    constexpr unsigned size() const noexcept { return flat::size; }
+
+    constexpr T get(index i) const { return c.get(i); }
+    template <class V, class U = T>
+    constexpr std::enable_if_t<std::is_class_v<U>, V> get(index i, V U::*m) const
+    {
+        return c.get(i, m);
+    }
+
+    T set(index i, T const& t)
+    {
+        mark(i);
+        return c.set(i, t);
+    }
+    template <class V, class U = T>
+    std::enable_if_t<std::is_class_v<U>, V> set(index i, V U::*m, V const& v)
+    {
+        mark(i);
+        return c.set(i, m, v);
+    }
+    bool maybe_set(int k, T const& t)
+    {
+        index i;
+        if (!flat::be(i, k)) {
+            return false;
+        }
+        set(i, t);
+        return true;
+    }
+    bool maybe_set(int m, int n, T const& t)
+    {
+        index i;
+        if (!flat::be(i, m, n)) {
+            return false;
+        }
+        set(i, t);
+        return true;
+    }
+    // Marks the block dirty, as it's probably written to
+    decltype(auto) grab(index i)
+    {
+        mark(i);
+        if constexpr (std::is_same_v<C, cobarray<T, flat::size>>) {
+            return c.grab(i);
+        }
+        else {
+            return std::move(c).grab(i);
+        }
+    }
+    void fill(T const& v)
+    {
+        c.fill(v);
+        mark_all();
+    }
+
+    // Read only access to the whole of it
+    constexpr C const& container() const { return c; }
+
+    // The elements of a block, to send them somewhere
+    constexpr cobspan<T const, B> elements(full b) const
+    {
+        static_assert(whole > 0, "There are no full blocks");
+        return c.span().template sub<B>(b * cobic<B>);
+    }
+    // The elements of the shorter last block
+    constexpr cobspan<T const, rest> tail() const
+    {
+        static_assert(rest > 0, "There is no shorter last block");
+        return c.span().template sub<rest>(cobic<whole * B>);
+    }
+    // Calls `f()` with the elements of any block, so `f` had better be
+    // generic, as the last one may be a `cobspan` of another size
+    template <class F> constexpr void elements(block b, F&& f) const
+    {
+        if constexpr (rest == 0) {
+            f(elements(b));
+        }
+        else if constexpr (whole == 0) {
+            f(tail());
+        }
+        else {
+            full k;
+            if (k.be(b.get())) {
+                f(elements(k));
+            }
+            else {
+                f(tail());
+            }
+        }
+    }
+
+    bool is_dirty(block b) const { return (bits[b.get() / 64] >> (b.get() % 64)) & 1; }
+    void clear_dirty()
+    {
+        for (auto& w: bits) {
+            w = 0;
+        }
+    }
+
+    // Goes through the dirty blocks, lowest first
+    class dirty_iterator {
+        std::uint64_t const* w;
+        int k;
+        std::uint64_t left;
+
+    public:
+        dirty_iterator(std::uint64_t const* w_, int k_)
+            : w(w_)
+            , k(k_)
+            , left((k_ < words) ? w_[k_] : 0)
+        {
+            skip();
+        }
+        block operator*() const
+        {
+            block rslt;
+            rslt.be(k * 64 + static_cast<int>(cobhlp::lowest(left)));
+            return rslt;
+        }
+        dirty_iterator& operator++()
+        {
+            left &= left - 1;
+            skip();
+            return *this;
+        }
+        bool operator==(dirty_iterator const& x) const { return (k == x.k) && (left == x.left); }
+        bool operator!=(dirty_iterator const& x) const { return !(*this == x); }
+
+    private:
+        void skip()
+        {
+            while ((left == 0) && (k < words)) {
+                if (++k < words) {
+                    left = w[k];
+                }
+            }
+        }
+    };
+    struct dirty_range {
+        std::uint64_t const* w;
+        dirty_iterator begin() const { return { w, 0 }; }
+        dirty_iterator end() const { return { w, words }; }
+    };
+    dirty_range dirty() const { return { bits }; }
+
+private:
+    void mark(index i)
+    {
+        int const b = flat::at(i) / B;
+        bits[b / 64] |= std::uint64_t{ 1 } << (b % 64);
+    }
+    void mark_all()
+    {
+        for (int b = 0; b < blocks; ++b) {
+            bits[b / 64] |= std::uint64_t{ 1 } << (b % 64);
+        }
+    }
+
+    C c;
+    std::uint64_t bits[words] = {};
+};
+
+
+#endif // !defined(INC_COBDIRTY)
@@ -0,0 +1,107 @@
+#include "cobdirty.hpp"
+
+#include <vector>
+#include <cassert>
+
+
+template <class R> std::vector<int> blocks_of(R const& r)
+{
+    std::vector<int> rslt;
+    for (auto b: r) {
+        rslt.push_back(b.get());
+    }
+    return rslt;
+}
+
+
+void arrays()
+{
+    struct S {
+        int a;
+        int b;
+    };
+    static cobdirty<cobarray<S, 1024>, 16> d;
+    assert(blocks_of(d.dirty()).empty());
+
+    d.set(cobic<0>, { 1, 2 });
+    d.set(cobic<17>, &S::b, 3);
+    d.grab(cobic<1023>)->a = 4;
+    assert(d.maybe_set(700, { 5, 6 }));
+    assert(!d.maybe_set(1024, { 5, 6 }));
+    assert((blocks_of(d.dirty()) == std::vector<int>{ 0, 1, 43, 63 }));
+    assert(d.is_dirty(cobic<43>));
+    assert(!d.is_dirty(cobic<42>));
+
+    assert(d.get(cobic<17>, &S::b) == 3);
+    assert(d.get(cobic<1023>).a == 4);
+    auto e = d.elements(cobic<63>);
+    assert(e[cobic<15>].a == 4);
+    assert(d.container().get(cobic<700>).b == 6);
+
+    d.clear_dirty();
+    assert(blocks_of(d.dirty()).empty());
+
+    d.fill({ 0, 0 });
+    assert(blocks_of(d.dirty()).size() == 64);
+}
+
+
+void many_words()
+{
+    static cobdirty<cobarray<char, 8192>, 8> d;
+    d.set(cobic<8191>, 'x');
+    d.set(cobic<64 * 8>, 'y');
+    assert((blocks_of(d.dirty()) == std::vector<int>{ 64, 1023 }));
+}
+
+
+void short_tail()
+{
+    static cobdirty<cobarray<int, 1000>> d;
+    static_assert(std::is_same_v<decltype(d)::block, cobint<0, 15>>);
+    d.set(cobic<999>, 9);
+    d.set(cobic<100>, 1);
+    assert((blocks_of(d.dirty()) == std::vector<int>{ 1, 15 }));
+    auto t = d.tail();
+    static_assert(std::is_same_v<decltype(t), cobspan<int const, 40>>);
+    assert(t[cobic<39>] == 9);
+    assert(d.elements(cobic<1>)[cobic<36>] == 1);
+
+    std::vector<int> sizes;
+    for (auto b: d.dirty()) {
+        d.elements(b, [&sizes](auto e) { sizes.push_back(e.size()); });
+    }
+    assert((sizes == std::vector<int>{ 64, 40 }));
+
+    static cobdirty<cobmatrix<char, 3, 5>, 16> m;
+    m.set({ cobic<2>, cobic<4> }, 'x');
+    assert((blocks_of(m.dirty()) == std::vector<int>{ 0 }));
+    assert(m.tail()[cobic<14>] == 'x');
+}
+
+
+void matrices()
+{
+    struct P {
+        int v;
+    };
+    static cobdirty<cobmatrix<P, 4, 8>, 8> d;
+    d.set({ cobic<2>, cobic<7> }, { 1 });
+    d.grab({ cobic<3>, cobic<0> })->v = 2;
+    assert(d.maybe_set(0, 1, { 3 }));
+    assert(!d.maybe_set(4, 1, { 3 }));
+    assert((blocks_of(d.dirty()) == std::vector<int>{ 0, 2, 3 }));
+    assert(d.elements(cobic<2>)[cobic<7>].v == 1);
+    assert(d.get({ cobic<3>, cobic<0> }).v == 2);
+}
+
+
+int main()
+{
+    arrays();
+    many_words();
+    short_tail();
+    matrices();
+
+    return 0;
+}
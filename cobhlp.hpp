@@ -6,6 +6,16 @@
 #if !defined(INC_COBHLP)
 #define INC_COBHLP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+template <class T, T D, T G> struct cobi;
+template <class T, T D, T G> struct cobsi;
+
 namespace cobhlp {
 
 // TODO avoid defining this ourselves
@@ -25,6 +35,128 @@ static constexpr unsigned log2(unsigned v)
     return r;
 }
 
+// Number of bits needed to write `v`
+static constexpr unsigned bitwidth(std::uintmax_t v)
+{
+    unsigned r = 0;
+    while (v > 0) {
+        ++r;
+        v >>= 1;
+    }
+    return r;
+}
+
+// Number of zero bits below the lowest one bit, `v` must not be 0
+inline unsigned lowest(std::uint64_t v)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(v));
+#else
+    unsigned r = 0;
+    while ((v & 1) == 0) {
+        ++r;
+        v >>= 1;
+    }
+    return r;
+#endif
+}
+
+// Smallest integer type that can hold all of [D, G], but never larger than T
+template <class T, T D, T G> struct fit {
+    using small = std::conditional_t<(D >= 0),
+        std::conditional_t<(static_cast<std::uintmax_t>(G) <= 0xFFU), std::uint8_t,
+        std::conditional_t<(static_cast<std::uintmax_t>(G) <= 0xFFFFU), std::uint16_t,
+        std::conditional_t<(static_cast<std::uintmax_t>(G) <= 0xFFFFFFFFU), std::uint32_t, T>>>,
+        std::conditional_t<((static_cast<std::intmax_t>(D) >= -0x80) && (G <= 0x7F)), std::int8_t,
+        std::conditional_t<((static_cast<std::intmax_t>(D) >= -0x8000) && (G <= 0x7FFF)), std::int16_t,
+        std::conditional_t<((static_cast<std::intmax_t>(D) >= -0x7FFFFFFF - 1) && (G <= 0x7FFFFFFF)),
+                           std::int32_t, T>>>>;
+    using type = std::conditional_t<(sizeof(small) < sizeof(T)), small, T>;
+};
+
+// Narrowest signed integer that can hold all of [D, G]. If `wide`, it's at
+// least 32 bits, for results, which are likely to be computed with further.
+template <std::intmax_t D, std::intmax_t G, bool wide = false> struct acc {
+    static_assert(D <= G, "Upper bound must be at least as high as lower");
+    using type = std::conditional_t<
+        !wide && (D >= INT16_MIN) && (G <= INT16_MAX), std::int16_t,
+        std::conditional_t<(D >= INT32_MIN) && (G <= INT32_MAX), std::int32_t, std::int64_t>>;
+};
+
+// Range of `N` times [D, G], which must not overflow
+template <int N, std::intmax_t D, std::intmax_t G> struct times {
+    static_assert((D >= INTMAX_MIN / N) && (G <= INTMAX_MAX / N), "Overflow");
+    static constexpr std::intmax_t lo = N * D;
+    static constexpr std::intmax_t hi = N * G;
+};
+
+// The type of the member that a member pointer points to
+template <class P> struct member;
+template <class V, class S> struct member<V S::*> {
+    using type = V;
+    using of = S;
+};
+
+// Number of members of aggregate `S`, as the most initializers that `S{}`
+// takes (a member that is an array counts as many as it has elements)
+struct any_member {
+    template <class T> constexpr operator T() const;
+};
+template <class S, class V, class... A> struct braces : std::false_type {};
+template <class S, class... A>
+struct braces<S, std::void_t<decltype(S{ std::declval<A>()... })>, A...> : std::true_type {};
+template <class S, class... A> constexpr std::size_t fields()
+{
+    if constexpr (braces<S, void, A..., any_member>::value) {
+        return fields<S, A..., any_member>();
+    }
+    else {
+        return sizeof...(A);
+    }
+}
+
+// Bulk operations on `n` contiguous `T`s, with `memcpy()` and friends
+// when that gives the same result. `T` may be a class, like `cobsi`, so
+// pointers go through `void*`, to keep `-Wclass-memaccess` quiet.
+template <class T> void copy(T* to, T const* from, std::size_t n)
+{
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memcpy(static_cast<void*>(to), from, n * sizeof(T));
+    }
+    else {
+        std::copy(from, from + n, to);
+    }
+}
+
+// Equal exactly when their bytes are. Not so for floating point, or any
+// other class, as its `operator==` may well look at only some members.
+template <class T> struct bitwise
+    : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>> {};
+template <class T, T D, T G> struct bitwise<cobi<T, D, G>> : std::true_type {};
+template <class T, T D, T G> struct bitwise<cobsi<T, D, G>> : std::true_type {};
+
+template <class T> bool equal(T const* l, T const* r, std::size_t n)
+{
+    if constexpr (bitwise<T>::value && std::has_unique_object_representations_v<T>) {
+        return std::memcmp(l, r, n * sizeof(T)) == 0;
+    }
+    else {
+        return std::equal(l, l + n, r);
+    }
+}
+
+template <class T> void fill(T* p, std::size_t n, T const& v)
+{
+    if constexpr (std::is_trivially_copyable_v<T> && (sizeof(T) == 1)) {
+        unsigned char c;
+        std::memcpy(&c, &v, 1);
+        std::memset(static_cast<void*>(p), c, n);
+    }
+    else {
+        std::fill(p, p + n, v);
+    }
+}
+
 template <class T> struct less {
     constexpr bool operator()(T const& l, T const& r) const { return l < r; }
 };
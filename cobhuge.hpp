@@ -0,0 +1,109 @@
+/* Containers on huge pages. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBHUGE)
+#define INC_COBHUGE
+
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include <sys/mman.h>
+
+
+// Size of a huge page, as on x86-64 and (most) ARM64
+constexpr std::size_t cob_huge_page = std::size_t{ 2 } << 20;
+
+
+// Owns a `C` (say, a big `cobarray` or `cobskiplist`), in memory of its
+// own, which starts on a huge page boundary and which the OS is asked to
+// back with huge pages (if it can), for fewer TLB misses.
+template <class C> class cobhuge {
+    static constexpr std::size_t length = ((sizeof(C) + cob_huge_page - 1) / cob_huge_page) * cob_huge_page;
+
+public:
+    // Makes the `C` from `a`, fails if there's no memory for it
+    template <template <class> class V, class... A> static V<cobhuge> make(A&&... a)
+    {
+        mapping m{ map() };
+        if (m.p == nullptr) {
+            return {};
+        }
+        C* c = new (m.p) C(std::forward<A>(a)...);
+        m.p = nullptr;
+        return cobhuge{ c };
+    }
+
+    cobhuge(cobhuge&& x)
+        : p(std::exchange(x.p, nullptr))
+    {
+    }
+    cobhuge& operator=(cobhuge&& x)
+    {
+        std::swap(p, x.p);
+        return *this;
+    }
+    cobhuge(cobhuge const&) = delete;
+    cobhuge& operator=(cobhuge const&) = delete;
+    ~cobhuge()
+    {
+        if (p != nullptr) {
+            p->~C();
+            ::munmap(p, length);
+        }
+    }
+
+    C&       operator*() { return *p; }
+    C const& operator*() const { return *p; }
+    C*       operator->() { return p; }
+    C const* operator->() const { return p; }
+
+private:
+    // Unmaps, unless released, so it's not leaked if `C()` throws
+    struct mapping {
+        void* p;
+        ~mapping()
+        {
+            if (p != nullptr) {
+                ::munmap(p, length);
+            }
+        }
+    };
+
+    explicit cobhuge(C* p_)
+        : p(p_)
+    {
+    }
+
+    // `mmap()` aligns only to (small) pages, so this maps a huge page more
+    // and gives back what's before and after the aligned part.
+    static void* map()
+    {
+        std::size_t const more = length + cob_huge_page;
+        void* m = ::mmap(nullptr, more, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (m == MAP_FAILED) {
+            return nullptr;
+        }
+        auto const at = reinterpret_cast<std::uintptr_t>(m);
+        auto const aligned = (at + cob_huge_page - 1) & ~(cob_huge_page - 1);
+        if (aligned > at) {
+            ::munmap(m, aligned - at);
+        }
+        if (at + more > aligned + length) {
+            ::munmap(reinterpret_cast<void*>(aligned + length), at + more - aligned - length);
+        }
+#if defined(MADV_HUGEPAGE)
+        ::madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    C* p;
+};
+
+
+#endif // !defined(INC_COBHUGE)
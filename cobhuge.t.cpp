@@ -0,0 +1,106 @@
+#include "cobhuge.hpp"
+#include "cobline.hpp"
+#include "cobarray.hpp"
+#include "cobskiplist.hpp"
+
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <cassert>
+#include <cstdint>
+
+
+void lines()
+{
+    static_assert(sizeof(cobline<char>) == cob_cache_line);
+    static_assert(alignof(cobline<int>) == cob_cache_line);
+    struct wide {
+        char c[100];
+    };
+    static_assert(sizeof(cobline<wide>) == 2 * cob_cache_line);
+
+    cobarray<cobline<long>, 4> a;
+    assert(reinterpret_cast<std::uintptr_t>(&a) % cob_cache_line == 0);
+    a.fill(0L);
+    std::thread t1([&a] {
+        for (int i = 0; i < 1000; ++i) {
+            a.grab(cobic<0>)->v += 1;
+        }
+    });
+    std::thread t2([&a] {
+        for (int i = 0; i < 1000; ++i) {
+            a.set(cobic<1>, a.get(cobic<1>) + 1);
+        }
+    });
+    t1.join();
+    t2.join();
+    assert(a.get(cobic<0>) == 1000);
+    assert(a.get(cobic<1>) == 1000);
+}
+
+
+void huge()
+{
+    using big = cobarray<int, 1000000>;
+    auto a = cobhuge<big>::make<std::optional>();
+    assert(a.has_value());
+    assert(reinterpret_cast<std::uintptr_t>(&**a) % cob_huge_page == 0);
+    (*a)->fill(3);
+    assert((*a)->get(cobic<999999>) == 3);
+
+    auto b = std::move(*a);
+    assert(b->get(cobic<0>) == 3);
+
+    auto s = cobhuge<cobskiplist<int, 1000>>::make<std::optional>();
+    assert(s.has_value());
+    assert((*s)->insert(5).second);
+    assert(*(*s)->begin() == 5);
+}
+
+
+struct throwing {
+    explicit throwing(int x)
+    {
+        if (x < 0) {
+            throw x;
+        }
+    }
+    char c[1 << 20];
+};
+
+int mappings()
+{
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    int rslt = 0;
+    while (std::getline(maps, line)) {
+        ++rslt;
+    }
+    return rslt;
+}
+
+void throws()
+{
+    int const before = mappings();
+    for (int i = 0; i < 10; ++i) {
+        try {
+            cobhuge<throwing>::make<std::optional>(-1);
+            assert(false);
+        }
+        catch (int) {
+        }
+    }
+    assert(mappings() <= before + 1);
+    assert(cobhuge<throwing>::make<std::optional>(1).has_value());
+}
+
+
+int main()
+{
+    lines();
+    huge();
+    throws();
+
+    return 0;
+}
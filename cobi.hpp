@@ -9,6 +9,9 @@
 #include <type_traits>
 #include <limits>
 #include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <utility>
 
 
 template<class T, T D, T G = D> struct cobrng {
@@ -32,6 +35,57 @@ public:
 };
 
 
+// Number of decimal digits needed to write `v`
+constexpr int cobdigits(std::uintmax_t v)
+{
+    int r = 1;
+    while (v >= 10) {
+        v /= 10;
+        ++r;
+    }
+    return r;
+}
+
+// Range of the remainder of [D1, G1] divided by [D2, G2] (which has no zero).
+// It has the sign of the dividend and is less than the divisor, by absolute
+// value, unless the dividend is already less than that.
+template <class T, T D1, T G1, T D2, T G2> struct cobremrng {
+    static constexpr T most = (D2 > 0) ? G2 - 1 : -(D2 + 1);
+    static constexpr T least = (D2 > 0) ? D2 - 1 : -(G2 + 1);
+
+    static constexpr T lo = (D1 >= 0) ? ((G1 <= least) ? D1 : 0) : std::max(D1, T(-most));
+    static constexpr T hi = (G1 <= 0) ? ((D1 >= T(-least)) ? G1 : 0) : std::min(G1, most);
+};
+
+// Division and remainder by [D2, G2], for dividends no less than D1. If the
+// divisor is a constant, it is given to the compiler as such, so it can use
+// shifting, masking and multiplication by the reciprocal. If neither is
+// negative, division is unsigned, which is cheaper.
+template <class T, T D1, T D2, T G2> struct cobdivisor {
+    using U = std::make_unsigned_t<T>;
+    static constexpr bool positive = (D1 >= 0) && (D2 > 0);
+
+    static constexpr T div(T x, T y)
+    {
+        if constexpr (positive) {
+            return static_cast<U>(x) / static_cast<U>((D2 == G2) ? D2 : y);
+        }
+        else {
+            return x / ((D2 == G2) ? D2 : y);
+        }
+    }
+    static constexpr T rem(T x, T y)
+    {
+        if constexpr (positive) {
+            return static_cast<U>(x) % static_cast<U>((D2 == G2) ? D2 : y);
+        }
+        else {
+            return x % ((D2 == G2) ? D2 : y);
+        }
+    }
+};
+
+
 template <class T, T D, T G = D> struct cobi {
     static_assert(std::is_integral<T>::value, "T must be an integer type");
     static_assert(D <= G, "Upper bound must be at least as high as lower");
@@ -87,6 +141,87 @@ template <class T, T D, T G = D> struct cobi {
             return {};
         }
     }
+    // Most characters needed to write any value in range
+    static constexpr int max_digits = cobdigits(std::max(
+        (D < 0) ? static_cast<std::uintmax_t>(-(D + 1)) + 1 : static_cast<std::uintmax_t>(D),
+        (G < 0) ? static_cast<std::uintmax_t>(-(G + 1)) + 1 : static_cast<std::uintmax_t>(G)));
+    static constexpr int max_chars = max_digits + (D < 0);
+
+    // Decimal, with a leading '-' if negative and any number of leading
+    // zeros. Anything else, including values out of range, is an error.
+    template <template <class> class V>
+    static constexpr V<cobi<T, D, G>> parse(std::string_view s)
+    {
+        std::size_t k = 0;
+        bool neg = false;
+        if constexpr (D < 0) {
+            if (!s.empty() && (s[0] == '-')) {
+                neg = true;
+                k = 1;
+            }
+        }
+        if (k == s.size()) {
+            return {};
+        }
+        while ((k + 1 < s.size()) && (s[k] == '0')) {
+            ++k;
+        }
+        if (s.size() - k > static_cast<std::size_t>(max_digits)) {
+            return {};
+        }
+        std::uintmax_t v = 0;
+        for (; k < s.size(); ++k) {
+            unsigned const c = static_cast<unsigned char>(s[k]) - '0';
+            if (c > 9) {
+                return {};
+            }
+            if constexpr (max_digits >= std::numeric_limits<std::uintmax_t>::digits10 + 1) {
+                if (v > (std::numeric_limits<std::uintmax_t>::max() - c) / 10) {
+                    return {};
+                }
+            }
+            v = v * 10 + c;
+        }
+        cobi<T, D, G> rslt;
+        if (neg) {
+            if ((v > 0) && (v - 1 > static_cast<std::uintmax_t>(-(D + 1)))) {
+                return {};
+            }
+            T const x = (v == 0) ? T(0) : -static_cast<T>(v - 1) - 1;
+            if (!rslt.be(x)) {
+                return {};
+            }
+        }
+        else {
+            if ((G < 0) || (v > static_cast<std::uintmax_t>(G)) || !rslt.be(static_cast<T>(v))) {
+                return {};
+            }
+        }
+        return rslt;
+    }
+
+    // Writes the value in decimal, returns the number of characters written
+    constexpr cobi<int, 1, max_chars> to_chars(char (&buf)[max_chars]) const
+    {
+        char tmp[max_chars] = {};
+        int n = 0;
+        std::uintmax_t v = (i < 0) ? static_cast<std::uintmax_t>(-(i + 1)) + 1 : i;
+        do {
+            tmp[n++] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        } while ((v > 0) && (n < max_digits));
+        int k = 0;
+        if (i < 0) {
+            buf[k++] = '-';
+        }
+        while ((n > 0) && (k < max_chars)) {
+            buf[k++] = tmp[--n];
+        }
+        cobi<int, 1, max_chars> rslt;
+        rslt.be(k);
+        return rslt;
+    }
+
     constexpr bool advance()
     {
         if (i < G) {
@@ -171,13 +306,14 @@ template <class T, T D, T G = D> struct cobi {
     operator/(cobi<U, D1, G1> x, cobi<U, D2, G2> y);
 
     template <class U, U D1, U G1, U D2, U G2>
-    friend constexpr cobi<U,
-                std::min(std::min(D1 % D2, G1 % G2), std::min(D1 % G2, G1 % D2)),
-                std::max(std::max(D1 % D2, G1 % G2), std::max(D1 % G2, G1 % D2))>
+    friend constexpr cobi<U, cobremrng<U, D1, G1, D2, G2>::lo, cobremrng<U, D1, G1, D2, G2>::hi>
     operator%(cobi<U, D1, G1> x, cobi<U, D2, G2> y);
 
     constexpr T get() const { return i; }
 
+    template <class U, U D1, U G1> friend struct cobsi;
+    template <int M> friend struct cobmod;
+
 private:
     T i;
 };
@@ -312,24 +448,20 @@ operator/(cobi<T, D1,G1> x, cobi<T, D2,G2> y)
          std::min(std::min(D1 / D2, G1 / G2), std::min(D1 / G2, G1 / D2)),
          std::max(std::max(D1 / D2, G1 / G2), std::max(D1 / G2, G1 / D2))>
         r;
-    r.i = x.i / y.i;
+    r.i = cobdivisor<T, D1, D2, G2>::div(x.i, y.i);
     return r;
 }
 
 template <class T, T D1, T G1, T D2, T G2>
-constexpr cobi<T, std::min(std::min(D1%D2, G1%G2), std::min(D1%G2, G1%D2)),
-        std::max(std::max(D1%D2, G1%G2), std::max(D1%G2, G1%D2))>
+constexpr cobi<T, cobremrng<T, D1, G1, D2, G2>::lo, cobremrng<T, D1, G1, D2, G2>::hi>
 operator%(cobi<T, D1,G1> x, cobi<T, D2,G2> y)
 {
     static_assert((D1 > std::numeric_limits<T>::lowest()) || (G2 < -1) || (D2 > -1),
                   "Modulo/Division Overflow");
     static_assert((G2 < 0) || (D2 > 0), "Possible modulo/division by zero");
 
-    cobi<T,
-         std::min(std::min(D1 % D2, G1 % G2), std::min(D1 % G2, G1 % D2)),
-         std::max(std::max(D1 % D2, G1 % G2), std::max(D1 % G2, G1 % D2))>
-        r;
-    r.i = x.i / y.i;
+    cobi<T, cobremrng<T, D1, G1, D2, G2>::lo, cobremrng<T, D1, G1, D2, G2>::hi> r;
+    r.i = cobdivisor<T, D1, D2, G2>::rem(x.i, y.i);
     return r;
 }
 
@@ -358,4 +490,46 @@ public:
 };
 
 
+
+template <class F, class C> constexpr bool cob_for_one(F& f, C i)
+{
+    if constexpr (std::is_same_v<decltype(f(i)), bool>) {
+        return f(i);
+    }
+    else {
+        f(i);
+        return true;
+    }
+}
+
+template <class T, T D, class F, std::size_t... K>
+constexpr bool cob_for_unrolled(F& f, std::index_sequence<K...>)
+{
+    return (cob_for_one(f, cobi<T, static_cast<T>(D + K), static_cast<T>(D + K)>{}) && ...);
+}
+
+// Calls `f` for each value of `C` (a `cobi`), from the lowest up. If `f`
+// returns `bool`, stops as soon as it returns `false`. Returns whether it went
+// through the whole range. For small ranges, the loop is unrolled and each
+// value is a constant of its own type (`cobi<T, K, K>`), so `f` had better be
+// generic (or take `C`). Otherwise, it's a plain loop over `C` values.
+template <class C, class F> constexpr bool cob_for(F f)
+{
+    using T = std::remove_const_t<decltype(C::DD)>;
+    constexpr T D = C::DD;
+    constexpr T G = C::GG;
+    if constexpr (static_cast<std::uintmax_t>(G) - static_cast<std::uintmax_t>(D) < 16) {
+        return cob_for_unrolled<T, D>(f, std::make_index_sequence<G - D + 1>{});
+    }
+    else {
+        cobi<T, D, G> i;
+        do {
+            if (!cob_for_one(f, i)) {
+                return false;
+            }
+        } while (i.advance());
+        return true;
+    }
+}
+
 #endif // !defined(INC_COBI)
@@ -0,0 +1,113 @@
+/* Compile time bound arrays, constructed on first use. For documentation,
+ * see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBLAZYARRAY)
+#define INC_COBLAZYARRAY
+
+
+#include "cobi.hpp"
+
+#include <new>
+
+
+// Like `cobarray<T, N>`, but elements are constructed when first set (or
+// grabbed), and always from the first up. Those above the highest one that
+// was set are not constructed, nor is their memory touched.
+template <class T, int N> class coblazyarray {
+    static_assert(N > 0, "Array must have at least one element");
+
+public:
+    using value_type      = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T*;
+    using reference       = T&;
+
+    using index = cobi<int, 0, N - 1>;
+
+    struct taken {
+        taken(T& t)
+            : t_(t)
+        {
+        }
+
+        taken(taken&&) = delete;
+        taken& operator=(taken&&) = delete;
+
+        constexpr T const* operator->() const&& { return &t_; }
+        constexpr T*       operator->() && { return &t_; }
+
+    private:
+        T& t_;
+    };
+
+    coblazyarray() {}
+    ~coblazyarray()
+    {
+        for (int k = built_.get(); k > 0; --k) {
+            at(k - 1)->~T();
+        }
+    }
+    coblazyarray(coblazyarray const&) = delete;
+    coblazyarray& operator=(coblazyarray const&) = delete;
+
+    constexpr bool     empty() const noexcept { return false; }
+    constexpr unsigned size() const noexcept { return N; }
+    constexpr unsigned max_size() const noexcept { return N; }
+
+    // How many elements are constructed, they are all below this
+    constexpr cobint<0, N> built() const { return built_; }
+
+    // For those that are not constructed, returns `T{}`
+    T get(index i) const { return (i.get() < built_.get()) ? *at(i.get()) : T{}; }
+    T set(index i, T const& t)
+    {
+        if (i.get() < built_.get()) {
+            return *at(i.get()) = t;
+        }
+        build(i.get());
+        new (raw(i.get())) T(t);
+        built_.be(i.get() + 1);
+        return t;
+    }
+    bool maybe_set(int i, T const& t)
+    {
+        index idx;
+        if (idx.be(i)) {
+            set(idx, t);
+            return true;
+        }
+        return false;
+    }
+    taken grab(index i)
+    {
+        if (i.get() >= built_.get()) {
+            build(i.get() + 1);
+        }
+        return *at(i.get());
+    }
+
+    constexpr cobirange<int, 0, N - 1> irange() const { return cobirange<int, 0, N - 1>{}; }
+
+private:
+    T*       at(int k) { return std::launder(reinterpret_cast<T*>(d) + k); }
+    T const* at(int k) const { return std::launder(reinterpret_cast<T const*>(d) + k); }
+    void*    raw(int k) { return d + k * sizeof(T); }
+
+    // Default constructs up to (but not including) `k`
+    void build(int k)
+    {
+        for (int j = built_.get(); j < k; ++j) {
+            new (raw(j)) T();
+            built_.be(j + 1);
+        }
+    }
+
+    cobint<0, N> built_;
+    alignas(T) unsigned char d[N * sizeof(T)];
+};
+
+
+#endif // !defined(INC_COBLAZYARRAY)
@@ -0,0 +1,43 @@
+/* Elements on cache lines of their own. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBLINE)
+#define INC_COBLINE
+
+
+#include <cstddef>
+
+
+// Size of a cache line, on all that we care about
+constexpr std::size_t cob_cache_line = 64;
+
+
+// A `T` that starts a cache line and is the only one on it (and the lines
+// after it, if it doesn't fit in one). In a container, elements that are
+// written to from different threads then don't share lines.
+template <class T> struct alignas(cob_cache_line) cobline {
+    using value_type = T;
+
+    T v;
+
+    constexpr cobline()
+        : v()
+    {
+    }
+    constexpr cobline(T const& x)
+        : v(x)
+    {
+    }
+
+    constexpr operator T() const { return v; }
+
+    constexpr T&       operator*() { return v; }
+    constexpr T const& operator*() const { return v; }
+    constexpr T*       operator->() { return &v; }
+    constexpr T const* operator->() const { return &v; }
+};
+
+
+#endif // !defined(INC_COBLINE)
@@ -8,6 +8,7 @@
 
 
 #include "cobarray.hpp"
+#include "cobsi.hpp"
 
 
 template <class T, int N>
@@ -21,6 +22,8 @@ struct coblist {
 
     using link = cobint<0, N>;
     using index = cobint<0, N-1>;
+    // As kept in the links array, in as few bytes as N allows
+    using slink = cobsi<int, 0, N>;
 
     static constexpr auto nil = cobic<N>;
 
@@ -444,8 +447,8 @@ private:
     T d[N+1];
     link head;
     link tail;
-    cobarray<link, N> next;
-    cobarray<link, N> prev;
+    cobarray<slink, N> next;
+    cobarray<slink, N> prev;
     link vacant;
 };
 
@@ -15,6 +15,7 @@ void print(coblist<T,N> const& l) {
 void basic()
 {
     coblist<int, 5> l;
+    static_assert(sizeof(coblist<int, 5>::slink) == 1);
 
     assert(l.empty());
     assert(l.size() == 0);
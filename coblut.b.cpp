@@ -0,0 +1,62 @@
+#include "coblut.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+// Duration to spoke mapping of a mill with 3 levels of 16 spokes each
+constexpr unsigned LVL = 3;
+constexpr unsigned DIM = 16;
+using duration = cobint<0, DIM * DIM * DIM - 1>;
+
+struct spoke {
+    unsigned lvl = 0;
+    unsigned offset = 0;
+};
+
+struct spoke_of {
+    constexpr spoke operator()(duration x) const
+    {
+        unsigned d = x.get();
+        for (unsigned lvl = 0; lvl < LVL; ++lvl) {
+            if (d < DIM) {
+                return { lvl, d };
+            }
+            d /= DIM;
+        }
+        return { LVL, 0 };
+    }
+};
+
+
+template <class F> void bench(char const* name, std::vector<duration> const& v, F f)
+{
+    unsigned sum = 0;
+    auto     start = std::chrono::steady_clock::now();
+    for (int r = 0; r < 20; ++r) {
+        for (auto x : v) {
+            spoke s = f(x);
+            sum += s.lvl + s.offset;
+        }
+    }
+    std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << t.count() / (20.0 * v.size()) << " ns/lookup (" << sum << ")\n";
+}
+
+
+int main()
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, duration::GG);
+    std::vector<duration> v(1 << 20);
+    for (auto& x : v) {
+        x.be(dist(rng));
+    }
+
+    bench("computed", v, spoke_of{});
+    bench("lookup  ", v, coblut<spoke_of, duration>{});
+
+    return 0;
+}
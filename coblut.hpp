@@ -0,0 +1,62 @@
+/* Compile time lookup tables, indexed by bound integers.
+ * For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBLUT)
+#define INC_COBLUT
+
+
+#include "cobarray.hpp"
+
+#include <type_traits>
+
+
+template <class F, class T, T D, T G>
+constexpr auto coblut_make()
+{
+    static_assert(static_cast<std::uintmax_t>(G) - static_cast<std::uintmax_t>(D) <
+                      static_cast<std::uintmax_t>(std::numeric_limits<int>::max()),
+                  "Range too wide for a lookup table");
+    using V = std::invoke_result_t<F, cobi<T, D, G>>;
+    constexpr int N = static_cast<int>(G - D) + 1;
+
+    cobarray<V, N> rslt{};
+    for (auto k : rslt.irange()) {
+        cobi<T, D, G> i;
+        i.be(static_cast<T>(D + k.get()));
+        rslt.set(k, F{}(i));
+    }
+    return rslt;
+}
+
+
+template <class F, class C> struct coblut;
+
+// Values of `F{}(i)` for every `i` in `[D, G]`, computed at compile time.
+// `F` has to be default constructible and its call operator `constexpr`.
+template <class F, class T, T D, T G> struct coblut<F, cobi<T, D, G>> {
+    using index      = cobi<T, D, G>;
+    using value_type = std::invoke_result_t<F, index>;
+
+    static constexpr auto table = coblut_make<F, T, D, G>();
+
+    static constexpr value_type get(index i) { return table.get(offset(i)); }
+    constexpr value_type operator()(index i) const { return get(i); }
+
+private:
+    static constexpr typename decltype(table)::index offset(index i)
+    {
+        if constexpr (std::is_same_v<T, int>) {
+            return i - cobic<D>;
+        }
+        else {
+            typename decltype(table)::index k;
+            k.be(static_cast<int>(i.get() - D));
+            return k;
+        }
+    }
+};
+
+#endif // !defined(INC_COBLUT)
@@ -8,9 +8,39 @@
 
 
 #include "cobi.hpp"
+#include "cobhlp.hpp"
+#include "cobspan.hpp"
 
 
-template <class T, int M, int N> struct cobmatrix {
+// Layouts of a matrix: where (in the storage) is the element at row `i`,
+// column `j` of an `M`x`N` matrix
+
+// Row by row, as in C
+struct cobrowmajor {
+    template <int M, int N> static constexpr int at(int i, int j) { return i * N + j; }
+};
+
+// Column by column, as in Fortran
+struct cobcolmajor {
+    template <int M, int N> static constexpr int at(int i, int j) { return j * M + i; }
+};
+
+// In `B`x`B` tiles, row by row, with the tile itself row by row, so that
+// the neighbours (in both directions) are close
+template <int B> struct cobtiled {
+    static_assert(B > 0, "Tiles must have at least one element");
+
+    template <int M, int N> static constexpr int at(int i, int j)
+    {
+        static_assert((M % B == 0) && (N % B == 0), "Tiles must cover the matrix exactly");
+        unsigned const ui = i;
+        unsigned const uj = j;
+        return static_cast<int>(((ui / B) * (N / B) + uj / B) * B * B + (ui % B) * B + uj % B);
+    }
+};
+
+
+template <class T, int M, int N, class L = cobrowmajor> struct cobmatrix {
     static_assert(M > 0, "Matrix must have at least one row");
     static_assert(N > 0, "Matrix must have at least one column");
 
@@ -18,6 +48,7 @@ template <class T, int M, int N> struct cobmatrix {
     using difference_type = std::ptrdiff_t;
     using pointer         = T*;
     using reference       = T&;
+    using layout          = L;
 
     using row    = cobi<int, 0, M - 1>;
     using column = cobi<int, 0, N - 1>;
@@ -42,18 +73,18 @@ template <class T, int M, int N> struct cobmatrix {
     constexpr unsigned size() const noexcept { return M * N; }
     constexpr unsigned max_size() const noexcept { return M * N; }
 
-    constexpr taken grab(index i) const&& { return d[i.irow.get()][i.icolumn.get()]; }
-    constexpr taken grab(index i) && { return d[i.irow.get()][i.icolumn.get()]; }
-    constexpr T get(index i) const { return d[i.irow.get()][i.icolumn.get()]; }
+    constexpr taken grab(index i) const&& { return d[at(i)]; }
+    constexpr taken grab(index i) && { return d[at(i)]; }
+    constexpr T get(index i) const { return d[at(i)]; }
     constexpr T set(index i, T const& t)
     {
-        return d[i.irow.get()][i.icolumn.get()] = t;
+        return d[at(i)] = t;
     }
     constexpr bool maybe_set(int m, int n, T const& t)
     {
         index idx;
         if (idx.irow.be(m) && idx.icolumn.be(n)) {
-            d[m][n] = t;
+            d[at(idx)] = t;
             return true;
         }
         return false;
@@ -61,31 +92,40 @@ template <class T, int M, int N> struct cobmatrix {
     template <class V, class U = T>
     constexpr std::enable_if_t<std::is_class_v<U>, V> get(index i, V U::*m) const
     {
-        return d[i.irow.get()][i.icolumn.get()].*m;
+        return d[at(i)].*m;
     }
     template <class V, class U = T>
     constexpr std::enable_if_t<std::is_class_v<U>, V> set(index i, V U::*m, V const& v)
     {
-        return d[i.irow.get()][i.icolumn.get()].*m = v;
+        return d[at(i)].*m = v;
     }
 
-    void fill(T const& v)
-    {
-        for (auto p = begin(); p != end(); ++p) {
-            *p = v;
-        }
-    }
+    // Where the element at `i` is, in the storage (and `span()`)
+    static constexpr int at(index i) { return L::template at<M, N>(i.irow.get(), i.icolumn.get()); }
+
+    // Elements are one after the other, so these go through all of them at once
+    void fill(T const& v) { cobhlp::fill(d, M * N, v); }
+
+    bool operator!=(cobmatrix const& x) const { return !cobhlp::equal(d, x.d, M * N); }
 
-    constexpr bool operator!=(cobmatrix const& x)
+    void copy_from(cobmatrix const& x) { cobhlp::copy(d, x.d, M * N); }
+    void assign(row r, cobspan<T const, N> x)
     {
-        auto [i, j] = std::mismatch(begin(), end(), x.begin());
-        return i != end();
+        if constexpr (std::is_same_v<L, cobrowmajor>) {
+            cobhlp::copy(d + r.get() * N, x.data(), N);
+        }
+        else {
+            for (auto j: x.irange()) {
+                d[at({ r, j })] = x.get(j);
+            }
+        }
     }
 
+    // Goes through the elements as they are in memory (so, for the default
+    // layout, row by row). It's just a pointer, which never goes past the end
     class I {
         cobmatrix* r;
-        T (*row)[N];
-        T* p;
+        T*         p;
 
     public:
         using value_type        = T;
@@ -96,72 +136,51 @@ template <class T, int M, int N> struct cobmatrix {
 
         I(I const& x)
             : r(x.r)
-            , row(x.row)
             , p(x.p)
         {
         }
 
-        I& operator=(I& x)
-        {
-            r   = x.r;
-            row = x.row;
-            p   = x.p;
-            return *this;
-        }
-        I& operator=(I&& x)
+        I& operator=(I const& x)
         {
-            r   = x.r;
-            row = x.row;
-            p   = x.p;
+            r = x.r;
+            p = x.p;
             return *this;
         }
         I& operator++()
         {
-            if (row - r->d < M) {
-                if (++p - *row == N) {
-                    ++row;
-                    p = *row;
-                }
+            if (p < r->last()) {
+                ++p;
             }
             return *this;
         }
         I& operator--()
         {
-            if (p == *row) {
-                if (row > r->d) {
-                    --row;
-                    p = (*row) + (N - 1);
-                }
-            }
-            else {
+            if (p > r->first()) {
                 --p;
             }
             return *this;
         }
         I operator+(difference_type x) const
         {
-            // Should optimize!
-            I rslt = *this;
-            for (unsigned i = 0; i < x; ++i) {
-                ++rslt;
+            if ((x <= r->last() - p) && (x >= r->first() - p)) {
+                return { r, p + x };
             }
-            return rslt;
+            return { r, r->last() };
         }
         I operator+=(difference_type x) { return *this = (*this) + x; }
         I operator-(difference_type x) const
         {
-            // Should optimize!
-            I rslt = *this;
-            for (unsigned i = 0; i < x; ++i) {
-                --rslt;
+            if ((x <= p - r->first()) && (x >= p - r->last())) {
+                return { r, p - x };
             }
-            return rslt;
+            return { r, r->last() };
         }
         I operator-=(difference_type x) { return *this = (*this) - x; }
         difference_type operator-(I const& x) const { return p - x.p; }
 
         T& operator*() const { return *p; }
         T* operator->() const { return p; }
+        T& operator[](difference_type x) const { return *(*this + x); }
 
         bool operator==(I const& x) const { return (r == x.r) && (p == x.p); }
         bool operator!=(I const& x) const { return (r != x.r) || (p != x.p); }
@@ -173,93 +192,70 @@ template <class T, int M, int N> struct cobmatrix {
         friend struct cobmatrix;
 
     protected:
-        I(cobmatrix const* r_, T (*row_)[N], T const* p_)
+        I(cobmatrix const* r_, T const* p_)
             : r(const_cast<cobmatrix*>(r_))
-            , row(const_cast<T (*)[N]>(row_))
             , p(const_cast<T*>(p_))
         {
         }
     };
     class CI {
         cobmatrix const* r;
-        T const (*row)[N];
-        T const* p;
+        T const*         p;
 
     public:
         using value_type        = T;
         using difference_type   = std::ptrdiff_t;
-        using pointer           = T*;
-        using reference         = T&;
+        using pointer           = T const*;
+        using reference         = T const&;
         using iterator_category = std::random_access_iterator_tag;
 
         CI(CI const& x)
             : r(x.r)
-            , row(x.row)
             , p(x.p)
         {
         }
 
-        CI& operator=(CI& x)
+        CI& operator=(CI const& x)
         {
-            r   = x.r;
-            row = x.row;
-            p   = x.p;
-            return *this;
-        }
-        CI& operator=(CI&& x)
-        {
-            r   = x.r;
-            row = x.row;
-            p   = x.p;
+            r = x.r;
+            p = x.p;
             return *this;
         }
         CI& operator++()
         {
-            if (row - r->d < M) {
-                if (++p - *row == N) {
-                    ++row;
-                    p = *row;
-                }
+            if (p < r->last()) {
+                ++p;
             }
             return *this;
         }
         CI& operator--()
         {
-            if (p == *row) {
-                if (row > r->d) {
-                    --row;
-                    p = (*row) + (N - 1);
-                }
-            }
-            else {
+            if (p > r->first()) {
                 --p;
             }
             return *this;
         }
         CI operator+(difference_type x) const
         {
-            // Should optimize!
-            I rslt = *this;
-            for (unsigned i = 0; i < x; ++i) {
-                ++rslt;
+            if ((x <= r->last() - p) && (x >= r->first() - p)) {
+                return { r, p + x };
             }
-            return rslt;
+            return { r, r->last() };
         }
         CI operator+=(difference_type x) { return *this = (*this) + x; }
         CI operator-(difference_type x) const
         {
-            // Should optimize!
-            I rslt = *this;
-            for (unsigned i = 0; i < x; ++i) {
-                --rslt;
+            if ((x <= p - r->first()) && (x >= p - r->last())) {
+                return { r, p - x };
             }
-            return rslt;
+            return { r, r->last() };
         }
         CI operator-=(difference_type x) { return *this = (*this) - x; }
         difference_type operator-(CI const& x) const { return p - x.p; }
 
         T const& operator*() const { return *p; }
         T const* operator->() const { return p; }
+        T const& operator[](difference_type x) const { return *(*this + x); }
 
         bool operator==(CI const& x) const { return (r == x.r) && (p == x.p); }
         bool operator!=(CI const& x) const { return (r != x.r) || (p != x.p); }
@@ -271,24 +267,65 @@ template <class T, int M, int N> struct cobmatrix {
         friend struct cobmatrix;
 
     protected:
-        CI(cobmatrix const* r_, T const (*row_)[N], T const* p_)
+        CI(cobmatrix const* r_, T const* p_)
             : r(r_)
-            , row(row_)
             , p(p_)
         {
         }
     };
 
-    constexpr I  begin() { return I{ this, &d[0], &d[0][0] }; }
-    constexpr I  end() { return I{ this, &d[M], &d[M][0] }; }
-    constexpr CI begin() const { return CI{ this, &d[0], &d[0][0] }; }
-    constexpr CI end() const { return CI{ this, &d[M], &d[M][0] }; }
-    constexpr CI cbegin() const { return CI{ this, &d[0], &d[0][0] }; }
-    constexpr CI cend() const { return CI{ this, &d[M], &d[M][0] }; }
+    constexpr I  begin() { return I{ this, first() }; }
+    constexpr I  end() { return I{ this, last() }; }
+    constexpr CI begin() const { return CI{ this, first() }; }
+    constexpr CI end() const { return CI{ this, last() }; }
+    constexpr CI cbegin() const { return CI{ this, first() }; }
+    constexpr CI cend() const { return CI{ this, last() }; }
+
+    // A row, which is a `cobspan` for the default layout, and a `cobstride`
+    // for column major
+    constexpr auto span(row r) { return row_of<T>(d, r); }
+    constexpr auto span(row r) const { return row_of<T const>(d, r); }
+
+    // Named so, as `row` and `column` are the names of their indices
+    constexpr auto row_view(row r) { return span(r); }
+    constexpr auto row_view(row r) const { return span(r); }
+    constexpr auto column_view(column c) { return column_of<T>(d, c); }
+    constexpr auto column_view(column c) const { return column_of<T const>(d, c); }
+
+    // All of it, as it is in memory
+    constexpr cobspan<T, M * N>       span() { return cobspan<T, M * N>::at(d); }
+    constexpr cobspan<T const, M * N> span() const { return cobspan<T const, M * N>::at(d); }
 
 
 private:
-    T d[M + 1][N];
+    template <class U> static constexpr auto row_of(U* p, row r)
+    {
+        if constexpr (std::is_same_v<L, cobrowmajor>) {
+            return cobspan<U, N>::at(p + r.get() * N);
+        }
+        else {
+            static_assert(std::is_same_v<L, cobcolmajor>, "Tiled matrices have no row views");
+            return cobstride<U, N, M>::at(p + r.get());
+        }
+    }
+    template <class U> static constexpr auto column_of(U* p, column c)
+    {
+        if constexpr (std::is_same_v<L, cobrowmajor>) {
+            return cobstride<U, M, N>::at(p + c.get());
+        }
+        else {
+            static_assert(std::is_same_v<L, cobcolmajor>, "Tiled matrices have no column views");
+            return cobspan<U, M>::at(p + c.get() * M);
+        }
+    }
+
+    constexpr T*       first() { return d; }
+    constexpr T const* first() const { return d; }
+    constexpr T*       last() { return d + M * N; }
+    constexpr T const* last() const { return d + M * N; }
+
+    // The last one is for landing
+    T d[M * N + 1];
 };
 
 #endif // define      INC_COBMATRIX
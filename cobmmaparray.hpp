@@ -0,0 +1,209 @@
+/* Compile time bound arrays, kept in a memory mapped file. For
+ * documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBMMAPARRAY)
+#define INC_COBMMAPARRAY
+
+
+#include "cobi.hpp"
+#include "cobspan.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+// Like `cobarray<T, N>`, but kept in a file, which is mapped in memory.
+// The file starts with a header that says what's in it, so it's not
+// opened as an array of some other type or size. `Tag` is for you to
+// change when `T` changes in a way that its size and alignment don't.
+template <class T, int N, std::uint64_t Tag = 0> class cobmmaparray {
+    static_assert(N > 0, "Array must have at least one element");
+    static_assert(std::is_trivially_copyable_v<T>, "Elements are kept as bytes");
+
+    struct header {
+        char          magic[8];
+        std::uint32_t version;
+        std::uint32_t size;
+        std::uint64_t count;
+        std::uint64_t layout;
+    };
+
+    static constexpr std::uint64_t mix(std::uint64_t h, std::uint64_t x)
+    {
+        return (h ^ x) * 0x100000001B3ull;
+    }
+    static constexpr std::uint64_t layout = mix(
+        mix(mix(mix(0xCBF29CE484222325ull, sizeof(T)), alignof(T)), N), Tag);
+    static constexpr std::uint32_t version = 1;
+
+    static constexpr std::size_t offset =
+        ((sizeof(header) + alignof(T) - 1) / alignof(T)) * alignof(T);
+    static constexpr std::size_t length = offset + sizeof(T) * N;
+
+public:
+    using value_type      = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T*;
+    using reference       = T&;
+
+    using index = cobi<int, 0, N - 1>;
+
+    struct taken {
+        taken(T& t)
+            : t_(t)
+        {
+        }
+
+        taken(taken&&) = delete;
+        taken& operator=(taken&&) = delete;
+
+        constexpr T const* operator->() const&& { return &t_; }
+        constexpr T*       operator->() && { return &t_; }
+
+    private:
+        T& t_;
+    };
+
+    // Opens the array in the file at `path`, creating it (with all
+    // elements zero) if there is no such file. Fails if the file is
+    // not of this array.
+    template <template <class> class V> static V<cobmmaparray> open(char const* path)
+    {
+        int fd = ::open(path, O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            return {};
+        }
+        void* p = map(fd);
+        ::close(fd);
+        if (p == nullptr) {
+            return {};
+        }
+        return cobmmaparray{ p };
+    }
+
+    cobmmaparray(cobmmaparray&& x)
+        : m(std::exchange(x.m, nullptr))
+    {
+    }
+    cobmmaparray& operator=(cobmmaparray&& x)
+    {
+        std::swap(m, x.m);
+        return *this;
+    }
+    cobmmaparray(cobmmaparray const&) = delete;
+    cobmmaparray& operator=(cobmmaparray const&) = delete;
+    ~cobmmaparray()
+    {
+        if (m != nullptr) {
+            ::munmap(m, length);
+        }
+    }
+
+    constexpr bool     empty() const noexcept { return false; }
+    constexpr unsigned size() const noexcept { return N; }
+    constexpr unsigned max_size() const noexcept { return N; }
+
+    taken grab(index i) { return d()[i.get()]; }
+    T     get(index i) const { return d()[i.get()]; }
+    T     set(index i, T const& t) { return d()[i.get()] = t; }
+
+    bool maybe_set(int i, T const& t)
+    {
+        index idx;
+        if (idx.be(i)) {
+            d()[idx.get()] = t;
+            return true;
+        }
+        return false;
+    }
+    template <class V, class U = T>
+    std::enable_if_t<std::is_class_v<U>, V> get(index i, V U::*m) const
+    {
+        return d()[i.get()].*m;
+    }
+    template <class V, class U = T>
+    std::enable_if_t<std::is_class_v<U>, V> set(index i, V U::*m, V const& v)
+    {
+        return d()[i.get()].*m = v;
+    }
+
+    void fill(T const& v)
+    {
+        for (auto& x: span()) {
+            x = v;
+        }
+    }
+
+    // Writes the changes to the file. If `wait`, returns when they are
+    // written, otherwise they are just scheduled for writing.
+    bool checkpoint(bool wait = true)
+    {
+        return ::msync(m, length, wait ? MS_SYNC : MS_ASYNC) == 0;
+    }
+
+    cobspan<T, N>       span() { return cobspan<T, N>{ *reinterpret_cast<T(*)[N]>(d()) }; }
+    cobspan<T const, N> span() const
+    {
+        return cobspan<T const, N>{ *reinterpret_cast<T const(*)[N]>(d()) };
+    }
+
+    constexpr cobirange<int, 0, N - 1> irange() const { return cobirange<int, 0, N - 1>{}; }
+
+private:
+    explicit cobmmaparray(void* p)
+        : m(p)
+    {
+    }
+
+    static void* map(int fd)
+    {
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            return nullptr;
+        }
+        bool fresh = (st.st_size == 0);
+        if (fresh) {
+            if (::ftruncate(fd, length) != 0) {
+                return nullptr;
+            }
+        }
+        else if (static_cast<std::uint64_t>(st.st_size) != length) {
+            return nullptr;
+        }
+        void* p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) {
+            return nullptr;
+        }
+        // If we crashed after growing the file, but before the header got
+        // to it, it's all zeros, so just carry on where we stopped.
+        header const zero{};
+        fresh = fresh || (std::memcmp(p, &zero, sizeof zero) == 0);
+        header h{ { 'c', 'o', 'b', 'm', 'm', 'a', 'p', '\0' }, version, sizeof(T), N, layout };
+        if (fresh) {
+            std::memcpy(p, &h, sizeof h);
+        }
+        else if (std::memcmp(p, &h, sizeof h) != 0) {
+            ::munmap(p, length);
+            return nullptr;
+        }
+        return p;
+    }
+
+    T*       d() { return reinterpret_cast<T*>(static_cast<char*>(m) + offset); }
+    T const* d() const { return reinterpret_cast<T const*>(static_cast<char const*>(m) + offset); }
+
+    void* m;
+};
+
+
+#endif // !defined(INC_COBMMAPARRAY)
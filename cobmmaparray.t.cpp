@@ -0,0 +1,108 @@
+#include "cobmmaparray.hpp"
+
+#include <optional>
+#include <string>
+#include <cassert>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+
+struct entry {
+    int key;
+    double value;
+};
+
+
+std::string temp_path()
+{
+    char path[] = "/tmp/cobmmaparray.XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    unlink(path);
+    return path;
+}
+
+
+void persist()
+{
+    auto path = temp_path();
+    {
+        auto a = cobmmaparray<entry, 1000>::open<std::optional>(path.c_str());
+        assert(a.has_value());
+        assert(a->get(cobic<999>).key == 0);
+        a->set(cobic<7>, { 7, 0.5 });
+        a->set(cobic<999>, &entry::key, 999);
+        a->grab(cobic<8>)->value = 8.5;
+        assert(a->checkpoint());
+    }
+    {
+        auto a = cobmmaparray<entry, 1000>::open<std::optional>(path.c_str());
+        assert(a.has_value());
+        assert(a->get(cobic<7>).key == 7);
+        assert(a->get(cobic<7>).value == 0.5);
+        assert(a->get(cobic<999>, &entry::key) == 999);
+        assert(a->get(cobic<8>, &entry::value) == 8.5);
+        auto s = a->span();
+        int sum = 0;
+        for (auto const& e: s) {
+            sum += e.key;
+        }
+        assert(sum == 1006);
+    }
+    unlink(path.c_str());
+}
+
+
+void mismatch()
+{
+    auto path = temp_path();
+    {
+        auto a = cobmmaparray<int, 100>::open<std::optional>(path.c_str());
+        assert(a.has_value());
+        a->fill(1);
+    }
+    assert(!(cobmmaparray<int, 101>::open<std::optional>(path.c_str())));
+    assert(!(cobmmaparray<unsigned, 100, 1>::open<std::optional>(path.c_str())));
+    assert(!(cobmmaparray<short, 200>::open<std::optional>(path.c_str())));
+    auto a = cobmmaparray<int, 100>::open<std::optional>(path.c_str());
+    assert(a.has_value());
+    assert(a->get(cobic<99>) == 1);
+    unlink(path.c_str());
+
+    assert(!(cobmmaparray<int, 100>::open<std::optional>("/nonexistent/dir/file")));
+}
+
+
+// As if we crashed after the file was grown, but before the header was
+// written.
+void interrupted()
+{
+    auto path = temp_path();
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    assert(fd >= 0);
+    assert(ftruncate(fd, 32 + 100 * sizeof(int)) == 0);
+    close(fd);
+    {
+        auto a = cobmmaparray<int, 100>::open<std::optional>(path.c_str());
+        assert(a.has_value());
+        assert(a->get(cobic<0>) == 0);
+        a->set(cobic<0>, 5);
+    }
+    auto a = cobmmaparray<int, 100>::open<std::optional>(path.c_str());
+    assert(a.has_value());
+    assert(a->get(cobic<0>) == 5);
+    assert(!(cobmmaparray<int, 99>::open<std::optional>(path.c_str())));
+    unlink(path.c_str());
+}
+
+
+int main()
+{
+    persist();
+    mismatch();
+    interrupted();
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/* Compile time bound modular (ring) integers. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBMOD)
+#define INC_COBMOD
+
+
+#include "cobi.hpp"
+
+
+template <int N> struct cobmod {
+    static_assert(N > 0, "Ring must have at least one element");
+
+    using value = cobint<0, N - 1>;
+
+    static constexpr bool pow2 = (N & (N - 1)) == 0;
+
+    constexpr cobmod() {}
+
+    template <int D, int G>
+    constexpr cobmod(cobint<D, G> x)
+        : i(x)
+    {
+    }
+
+    template <class U> static constexpr cobmod wrap(U x)
+    {
+        static_assert(std::is_integral<U>::value, "U must be an integer type");
+        if constexpr (pow2) {
+            return made(static_cast<int>(static_cast<std::make_unsigned_t<U>>(x) & (N - 1)));
+        }
+        else {
+            auto r = x % N;
+            return made(static_cast<int>((r < 0) ? r + N : r));
+        }
+    }
+
+    constexpr cobmod& operator++()
+    {
+        *this = *this + cobmod{ cobic<(N > 1) ? 1 : 0> };
+        return *this;
+    }
+    constexpr cobmod& operator--()
+    {
+        *this = *this - cobmod{ cobic<(N > 1) ? 1 : 0> };
+        return *this;
+    }
+
+    friend constexpr cobmod operator+(cobmod x, cobmod y)
+    {
+        int const s = x.get() + y.get();
+        if constexpr (pow2) {
+            return made(s & (N - 1));
+        }
+        else {
+            return made((s >= N) ? s - N : s);
+        }
+    }
+    friend constexpr cobmod operator-(cobmod x, cobmod y)
+    {
+        int const s = x.get() - y.get();
+        if constexpr (pow2) {
+            return made(static_cast<int>(static_cast<unsigned>(s) & (N - 1)));
+        }
+        else {
+            return made((s < 0) ? s + N : s);
+        }
+    }
+
+    constexpr bool operator==(cobmod x) const { return i == x.i; }
+    constexpr bool operator!=(cobmod x) const { return i != x.i; }
+    template <int D, int G> constexpr bool operator==(cobint<D, G> x) const { return i == x; }
+    template <int D, int G> constexpr bool operator!=(cobint<D, G> x) const { return i != x; }
+
+    constexpr operator value() const { return i; }
+    constexpr int get() const { return i.get(); }
+
+private:
+    // Only for `x` we know is in range, skips the check
+    static constexpr cobmod made(int x)
+    {
+        cobmod rslt;
+        rslt.i.i = x;
+        return rslt;
+    }
+
+    value i;
+};
+
+
+#endif // !defined(INC_COBMOD)
@@ -0,0 +1,287 @@
+/* Numeric algorithms over compile time bound arrays.
+ * For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBNUMERIC)
+#define INC_COBNUMERIC
+
+
+#include "cobarray.hpp"
+#include "cobhlp.hpp"
+#include "cobmatrix.hpp"
+
+#include <utility>
+
+
+// Sum of all the elements. The sum is accumulated in the narrowest integer the
+// bounds allow, so compilers can vectorize it with as many lanes as possible.
+template <class T, T D, T G, int N>
+constexpr auto cob_sum(cobarray<cobi<T, D, G>, N> const& a)
+{
+    using rng = cobhlp::times<N, D, G>;
+    using A   = typename cobhlp::acc<rng::lo, rng::hi>::type;
+    using R   = typename cobhlp::acc<rng::lo, rng::hi, true>::type;
+
+    A acc = 0;
+    for (int k = 0; k < N; ++k) {
+        typename cobarray<cobi<T, D, G>, N>::index i;
+        i.be(k);
+        acc += static_cast<A>(a.get(i).get());
+    }
+    cobi<R, rng::lo, rng::hi> rslt;
+    rslt.be(acc);
+    return rslt;
+}
+
+// Sum of the products of the elements at the same index, accumulated just
+// like for `cob_sum()`.
+template <class T, T D1, T G1, T D2, T G2, int N>
+constexpr auto cob_dot(cobarray<cobi<T, D1, G1>, N> const& a, cobarray<cobi<T, D2, G2>, N> const& b)
+{
+    using p   = decltype(cobi<std::intmax_t, D1, G1>{} * cobi<std::intmax_t, D2, G2>{});
+    using rng = cobhlp::times<N, p::DD, p::GG>;
+    using A   = typename cobhlp::acc<rng::lo, rng::hi>::type;
+    using R   = typename cobhlp::acc<rng::lo, rng::hi, true>::type;
+
+    A acc = 0;
+    for (int k = 0; k < N; ++k) {
+        typename cobarray<cobi<T, D1, G1>, N>::index i;
+        i.be(k);
+        acc += static_cast<A>(a.get(i).get()) * static_cast<A>(b.get(i).get());
+    }
+    cobi<R, rng::lo, rng::hi> rslt;
+    rslt.be(acc);
+    return rslt;
+}
+
+// Reduces plain numbers with `op`, from the first to the last. Compilers
+// vectorize this for integers (and the usual `op`s), but not for floating
+// point, unless allowed to reorder operations (`-ffast-math`). There's no
+// such thing for `cobi`s, as we can't know the range of the result of any
+// `op`. For the sum, there's `cob_sum()`.
+template <class T, int N, class OP>
+constexpr std::enable_if_t<std::is_arithmetic_v<T>, T> cob_reduce(cobarray<T, N> const& a, T init, OP op)
+{
+    auto const p = a.span().data();
+    for (int k = 0; k < N; ++k) {
+        init = op(init, p[k]);
+    }
+    return init;
+}
+
+// Each element is the sum of all before it and itself. For `cobi`s, the
+// range of the result is that of all the sums, from one to `N` elements.
+template <class T, T D, T G, int N>
+constexpr auto cob_inclusive_scan(cobarray<cobi<T, D, G>, N> const& a)
+{
+    using rng = cobhlp::times<N, D, G>;
+    constexpr std::intmax_t lo = (D < rng::lo) ? D : rng::lo;
+    constexpr std::intmax_t hi = (G > rng::hi) ? G : rng::hi;
+    using R = typename cobhlp::acc<lo, hi, true>::type;
+    using E = cobi<R, lo, hi>;
+
+    cobarray<E, N> rslt;
+    R acc = 0;
+    for (auto i: rslt.irange()) {
+        acc += a.get(i).get();
+        E x;
+        x.be(acc);
+        rslt.set(i, x);
+    }
+    return rslt;
+}
+
+// Each element is the sum of all before it, the first is 0
+template <class T, T D, T G, int N>
+constexpr auto cob_exclusive_scan(cobarray<cobi<T, D, G>, N> const& a)
+{
+    using rng = cobhlp::times<N - 1 + (N == 1), D, G>;
+    constexpr std::intmax_t lo = (N == 1) ? 0 : ((rng::lo < 0) ? rng::lo : 0);
+    constexpr std::intmax_t hi = (N == 1) ? 0 : ((rng::hi > 0) ? rng::hi : 0);
+    using R = typename cobhlp::acc<lo, hi, true>::type;
+    using E = cobi<R, lo, hi>;
+
+    cobarray<E, N> rslt;
+    std::intmax_t acc = 0;
+    for (auto i: rslt.irange()) {
+        E x;
+        x.be(static_cast<R>(acc));
+        rslt.set(i, x);
+        acc += a.get(i).get();
+    }
+    return rslt;
+}
+
+// For plain numbers, sums are of the same type
+template <class T, int N>
+constexpr std::enable_if_t<std::is_arithmetic_v<T>, cobarray<T, N>> cob_inclusive_scan(cobarray<T, N> const& a)
+{
+    cobarray<T, N> rslt;
+    auto const p = a.span().data();
+    auto const q = rslt.span().data();
+    T acc = 0;
+    for (int k = 0; k < N; ++k) {
+        q[k] = acc += p[k];
+    }
+    return rslt;
+}
+
+template <class T, int N>
+constexpr std::enable_if_t<std::is_arithmetic_v<T>, cobarray<T, N>> cob_exclusive_scan(cobarray<T, N> const& a)
+{
+    cobarray<T, N> rslt;
+    auto const p = a.span().data();
+    auto const q = rslt.span().data();
+    T acc = 0;
+    for (int k = 0; k < N; ++k) {
+        q[k] = acc;
+        acc += p[k];
+    }
+    return rslt;
+}
+
+namespace cobhlp {
+// Matrix multiplication, `A` is `M`x`K`, `B` is `K`x`N`. It's tiled for
+// the cache, not the registers: `R` rows of `A` times `TK` rows of `B`,
+// `TN` columns at a time, so the rows of `B` and `C` of a tile stay in L1
+// while they are summed into (in memory, as a row of `C` is too long for
+// registers). The innermost loop goes along a row, so it's vectorized.
+// For dimensions that the tiles don't divide, the last tile is of its
+// own size, so there are no runtime checks in the loops.
+template <class T, int M, int K, int N> struct matmul {
+    static constexpr int R  = (M < 4) ? M : 4;
+    static constexpr int TK = (K < 64) ? K : 64;
+    static constexpr int TN = (N < 256) ? N : 256;
+
+    template <int RR, int KK, int NN> static void kernel(T const* a, T const* b, T* c)
+    {
+        for (int k = 0; k < KK; ++k) {
+            for (int r = 0; r < RR; ++r) {
+                T const x = a[r * K + k];
+                for (int j = 0; j < NN; ++j) {
+                    c[r * N + j] += x * b[k * N + j];
+                }
+            }
+        }
+    }
+    template <int RR, int KK> static void columns(T const* a, T const* b, T* c)
+    {
+        int j = 0;
+        for (; j + TN <= N; j += TN) {
+            kernel<RR, KK, TN>(a, b + j, c + j);
+        }
+        if constexpr (N % TN != 0) {
+            kernel<RR, KK, N % TN>(a, b + j, c + j);
+        }
+    }
+    template <int RR> static void inner(T const* a, T const* b, T* c)
+    {
+        int k = 0;
+        for (; k + TK <= K; k += TK) {
+            columns<RR, TK>(a + k, b + k * N, c);
+        }
+        if constexpr (K % TK != 0) {
+            columns<RR, K % TK>(a + k, b + k * N, c);
+        }
+    }
+    static void run(T const* a, T const* b, T* c)
+    {
+        int i = 0;
+        for (; i + R <= M; i += R) {
+            inner<R>(a + i * K, b, c + i * N);
+        }
+        if constexpr (M % R != 0) {
+            inner<M % R>(a + i * K, b, c + i * N);
+        }
+    }
+};
+
+// Transposes the `m`x`n` part at `a` (rows `LA` apart) to `b` (rows `LB`
+// apart), halving the longer side until it fits in the cache (whatever
+// its size is)
+template <int LA, int LB, class T> void transpose(T const* a, T* b, int m, int n)
+{
+    if ((m <= 16) && (n <= 16)) {
+        for (int i = 0; i < m; ++i) {
+            for (int j = 0; j < n; ++j) {
+                b[j * LB + i] = a[i * LA + j];
+            }
+        }
+    }
+    else if (m >= n) {
+        transpose<LA, LB>(a, b, m / 2, n);
+        transpose<LA, LB>(a + (m / 2) * LA, b + m / 2, m - m / 2, n);
+    }
+    else {
+        transpose<LA, LB>(a, b, m, n / 2);
+        transpose<LA, LB>(a + n / 2, b + (n / 2) * LB, m, n - n / 2);
+    }
+}
+
+// Swaps the `m`x`n` part at `a` with the transposed one at `b`, both with
+// rows `L` apart, in the same way
+template <int L, class T> void swap_transposed(T* a, T* b, int m, int n)
+{
+    if ((m <= 16) && (n <= 16)) {
+        for (int i = 0; i < m; ++i) {
+            for (int j = 0; j < n; ++j) {
+                std::swap(a[i * L + j], b[j * L + i]);
+            }
+        }
+    }
+    else if (m >= n) {
+        swap_transposed<L>(a, b, m / 2, n);
+        swap_transposed<L>(a + (m / 2) * L, b + m / 2, m - m / 2, n);
+    }
+    else {
+        swap_transposed<L>(a, b, m, n / 2);
+        swap_transposed<L>(a + n / 2, b + (n / 2) * L, m, n - n / 2);
+    }
+}
+
+// Transposes the `n`x`n` part on the diagonal at `a`
+template <int L, class T> void transpose_in_place(T* a, int n)
+{
+    if (n <= 16) {
+        for (int i = 0; i < n; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                std::swap(a[i * L + j], a[j * L + i]);
+            }
+        }
+    }
+    else {
+        int const h = n / 2;
+        transpose_in_place<L>(a, h);
+        transpose_in_place<L>(a + h * L + h, n - h);
+        swap_transposed<L>(a + h, a + h * L, h, n - h);
+    }
+}
+} // namespace cobhlp
+
+
+// Product of matrices, which have to agree on `K`, or it won't compile
+template <class T, int M, int K, int N>
+cobmatrix<T, M, N> cob_matmul(cobmatrix<T, M, K> const& a, cobmatrix<T, K, N> const& b)
+{
+    cobmatrix<T, M, N> rslt;
+    rslt.fill(T{});
+    cobhlp::matmul<T, M, K, N>::run(a.span().data(), b.span().data(), rslt.span().data());
+    return rslt;
+}
+
+template <class T, int M, int N> cobmatrix<T, N, M> cob_transpose(cobmatrix<T, M, N> const& a)
+{
+    cobmatrix<T, N, M> rslt;
+    cobhlp::transpose<N, M>(a.span().data(), rslt.span().data(), M, N);
+    return rslt;
+}
+
+// Only square matrices can be transposed in place
+template <class T, int N> void cob_transpose_in_place(cobmatrix<T, N, N>& a)
+{
+    cobhlp::transpose_in_place<N>(a.span().data(), N);
+}
+
+#endif // !defined(INC_COBNUMERIC)
@@ -0,0 +1,198 @@
+#include "cobnumeric.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+
+void sum()
+{
+    cobarray<cobi<std::int8_t, -100, 100>, 300> a;
+    for (auto i: a.irange()) {
+        cobi<std::int8_t, -100, 100> x;
+        x.be(static_cast<std::int8_t>((i.get() % 3 == 0) ? 100 : -50));
+        a.set(i, x);
+    }
+    auto s = cob_sum(a);
+    static_assert(std::is_same_v<decltype(s), cobi<std::int32_t, -30000, 30000>>);
+    assert(s == 0);
+
+    cobarray<cobint<0, 1000>, 4> b;
+    b.fill(cobic<1000>);
+    auto t = cob_sum(b);
+    static_assert((t.DD == 0) && (t.GG == 4000));
+    assert(t == 4000);
+}
+
+
+void dot()
+{
+    using nibble = cobi<std::int8_t, 0, 15>;
+    cobarray<nibble, 100> a;
+    cobarray<cobi<std::int8_t, -15, 15>, 100> b;
+    for (auto i: a.irange()) {
+        nibble x;
+        x.be(static_cast<std::int8_t>(i.get() % 16));
+        a.set(i, x);
+        b.set(i, -x);
+    }
+    auto d = cob_dot(a, b);
+    static_assert((d.DD == -22500) && (d.GG == 22500));
+    int expected = 0;
+    for (int i = 0; i < 100; ++i) {
+        expected -= (i % 16) * (i % 16);
+    }
+    assert(d == expected);
+}
+
+
+void reduce()
+{
+    cobarray<float, 64> a;
+    a.fill(0.5f);
+    assert(cob_reduce(a, 1.0f, [](float l, float r) { return l + r; }) == 33.0f);
+    cobarray<unsigned, 10> b;
+    b.fill(1);
+    b.set(cobic<3>, 8);
+    assert(cob_reduce(b, 0u, [](unsigned l, unsigned r) { return l | r; }) == 9);
+}
+
+
+void scan()
+{
+    using small = cobi<std::int8_t, -1, 3>;
+    cobarray<small, 5> a;
+    for (auto i: a.irange()) {
+        small x;
+        x.be(static_cast<std::int8_t>(i.get() - 1));
+        a.set(i, x);
+    }
+    auto in = cob_inclusive_scan(a);
+    using I = decltype(in.get(cobic<0>));
+    static_assert((I::DD == -5) && (I::GG == 15));
+    int const expected_in[] = { -1, -1, 0, 2, 5 };
+    for (auto i: a.irange()) {
+        assert(in.get(i) == expected_in[i.get()]);
+    }
+
+    auto ex = cob_exclusive_scan(a);
+    using X = decltype(ex.get(cobic<0>));
+    static_assert((X::DD == -4) && (X::GG == 12));
+    int const expected_ex[] = { 0, -1, -1, 0, 2 };
+    for (auto i: a.irange()) {
+        assert(ex.get(i) == expected_ex[i.get()]);
+    }
+
+    cobarray<cobint<1, 2>, 1> one;
+    auto ex1 = cob_exclusive_scan(one);
+    using X1 = decltype(ex1.get(cobic<0>));
+    static_assert((X1::DD == 0) && (X1::GG == 0));
+
+    cobarray<double, 4> d;
+    d.fill(1.5);
+    auto ind = cob_inclusive_scan(d);
+    assert(ind.get(cobic<3>) == 6.0);
+    auto exd = cob_exclusive_scan(d);
+    assert(exd.get(cobic<0>) == 0.0);
+    assert(exd.get(cobic<3>) == 4.5);
+}
+
+
+template <int M, int K, int N> void matmul_against_naive()
+{
+    static cobmatrix<long, M, K> a;
+    static cobmatrix<long, K, N> b;
+    int n = 0;
+    for (auto& x: a) {
+        x = (n++ * 31) % 17 - 8;
+    }
+    for (auto& x: b) {
+        x = (n++ * 7) % 13 - 6;
+    }
+    auto c = cob_matmul(a, b);
+    static_assert(std::is_same_v<decltype(c), cobmatrix<long, M, N>>);
+    auto pa = a.span().data();
+    auto pb = b.span().data();
+    auto pc = c.span().data();
+    for (int i = 0; i < M; ++i) {
+        for (int j = 0; j < N; ++j) {
+            long expected = 0;
+            for (int k = 0; k < K; ++k) {
+                expected += pa[i * K + k] * pb[k * N + j];
+            }
+            assert(pc[i * N + j] == expected);
+        }
+    }
+}
+
+
+void matmul()
+{
+    cobmatrix<int, 2, 3> a;
+    cobmatrix<int, 3, 2> b;
+    int n = 1;
+    for (auto& x: a) {
+        x = n++;
+    }
+    for (auto& x: b) {
+        x = n++;
+    }
+    auto c = cob_matmul(a, b);
+    assert(c.get({ cobic<0>, cobic<0> }) == 1 * 7 + 2 * 9 + 3 * 11);
+    assert(c.get({ cobic<1>, cobic<1> }) == 4 * 8 + 5 * 10 + 6 * 12);
+    // cob_matmul(a, a); // Won't compile, 3 columns, but 2 rows
+
+    matmul_against_naive<1, 1, 1>();
+    matmul_against_naive<4, 64, 256>();
+    matmul_against_naive<7, 65, 300>();
+    matmul_against_naive<33, 130, 17>();
+}
+
+
+template <int M, int N> void transpose_against_naive()
+{
+    static cobmatrix<int, M, N> a;
+    int n = 0;
+    for (auto& x: a) {
+        x = n++;
+    }
+    auto t = cob_transpose(a);
+    static_assert(std::is_same_v<decltype(t), cobmatrix<int, N, M>>);
+    for (int i = 0; i < M; ++i) {
+        for (int j = 0; j < N; ++j) {
+            assert(t.span().data()[j * M + i] == i * N + j);
+        }
+    }
+}
+
+
+void transpose()
+{
+    transpose_against_naive<1, 1>();
+    transpose_against_naive<3, 70>();
+    transpose_against_naive<100, 37>();
+
+    static cobmatrix<int, 45, 45> s;
+    int n = 0;
+    for (auto& x: s) {
+        x = n++;
+    }
+    cob_transpose_in_place(s);
+    for (int i = 0; i < 45; ++i) {
+        for (int j = 0; j < 45; ++j) {
+            assert(s.span().data()[i * 45 + j] == j * 45 + i);
+        }
+    }
+}
+
+
+int main()
+{
+    sum();
+    dot();
+    reduce();
+    scan();
+    matmul();
+    transpose();
+
+    return 0;
+}
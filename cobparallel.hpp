@@ -0,0 +1,187 @@
+/* Parallel algorithms over compile time bound arrays. For documentation,
+ * see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBPARALLEL)
+#define INC_COBPARALLEL
+
+
+#include "cobarray.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+// Number of chunks an array is split into. Each chunk is a type of its
+// own, so this is compile time and should be a few times the number of
+// threads, to even out the load.
+#if !defined(COB_PARALLEL_CHUNKS)
+#define COB_PARALLEL_CHUNKS 64
+#endif
+
+
+// A fixed size thread pool, that runs one job at a time. A job is `count`
+// calls of `work`, with `[0, count)`, in no particular order, on all the
+// threads, including the caller. Jobs are not to be nested.
+class cobthreadpool {
+public:
+    explicit cobthreadpool(unsigned threads)
+    {
+        for (unsigned t = 1; t < threads; ++t) {
+            workers.emplace_back([this] { serve(); });
+        }
+    }
+    ~cobthreadpool()
+    {
+        {
+            std::lock_guard<std::mutex> l(m);
+            quit = true;
+        }
+        wake.notify_all();
+        for (auto& t: workers) {
+            t.join();
+        }
+    }
+    cobthreadpool(cobthreadpool const&) = delete;
+    cobthreadpool& operator=(cobthreadpool const&) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    void run(int count, std::function<void(int)> const& work)
+    {
+        std::lock_guard<std::mutex> one(job);
+        batch b{&work, count, count};
+        {
+            std::lock_guard<std::mutex> l(m);
+            current = &b;
+            ++generation;
+        }
+        wake.notify_all();
+        int const done = pitch_in(b);
+        std::unique_lock<std::mutex> l(m);
+        b.left -= done;
+        finished.wait(l, [&b] { return (b.left == 0) && (b.busy == 0); });
+        current = nullptr;
+    }
+
+    // The one used by `cob_parallel_*()`, with a thread per hardware thread
+    static cobthreadpool& common()
+    {
+        static cobthreadpool pool(std::max(1u, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+private:
+    // State of one job, on the stack of `run()`, which doesn't return
+    // until all the workers that took it are done with it, so items of
+    // one job can't be claimed by a worker that is late for it.
+    struct batch {
+        std::function<void(int)> const* todo;
+        int total;
+        int left;
+        int busy = 0;
+        std::atomic<int> next{0};
+    };
+
+    void serve()
+    {
+        unsigned seen = 0;
+        for (;;) {
+            batch* b;
+            {
+                std::unique_lock<std::mutex> l(m);
+                wake.wait(l, [&] { return quit || (generation != seen); });
+                if (quit) {
+                    return;
+                }
+                seen = generation;
+                b = current;
+                if (b == nullptr) {
+                    continue;
+                }
+                ++b->busy;
+            }
+            int const done = pitch_in(*b);
+            {
+                std::lock_guard<std::mutex> l(m);
+                b->left -= done;
+                --b->busy;
+                if ((b->left == 0) && (b->busy == 0)) {
+                    finished.notify_all();
+                }
+            }
+        }
+    }
+    static int pitch_in(batch& b)
+    {
+        int done = 0;
+        for (int k = b.next++; k < b.total; k = b.next++) {
+            (*b.todo)(k);
+            ++done;
+        }
+        return done;
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex job;
+    std::mutex m;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    batch* current = nullptr;
+    unsigned generation = 0;
+    bool quit = false;
+};
+
+
+namespace cobhlp {
+template <int N, int C, int K> struct chunk {
+    static constexpr int lo = static_cast<int>(static_cast<long long>(N) * K / C);
+    static constexpr int hi = static_cast<int>(static_cast<long long>(N) * (K + 1) / C) - 1;
+    using type = cobi<int, lo, hi>;
+};
+
+template <int N, int C, class F, int... K>
+void run_chunk(F& f, int k, std::integer_sequence<int, K...>)
+{
+    ((k == K ? (f(typename chunk<N, C, K>::type{}), true) : false) || ...);
+}
+} // namespace cobhlp
+
+
+// Calls `f(i)` for each index of `a`, on all the threads of the common
+// pool. `i` is not `index` but a `cobi` of its chunk, so `f` had better be
+// generic. It converts to `index` as is, and is as good for `get()`,
+// `set()`, `grab()`... Chunks run concurrently, so `f` should only touch
+// the elements at its `i`.
+template <class T, int N, class F> void cob_parallel_for(cobarray<T, N>&, F f)
+{
+    constexpr int C = (N < COB_PARALLEL_CHUNKS) ? N : COB_PARALLEL_CHUNKS;
+    auto sweep = [&f](auto first) {
+        decltype(first) i;
+        do {
+            f(i);
+        } while (i.advance());
+    };
+    cobthreadpool::common().run(C, [&sweep](int k) {
+        cobhlp::run_chunk<N, C>(sweep, k, std::make_integer_sequence<int, C>{});
+    });
+}
+
+// Sets each element of `out` to `f()` of the same element of `in`, on all
+// the threads of the common pool.
+template <class T, class U, int N, class F>
+void cob_parallel_transform(cobarray<T, N> const& in, cobarray<U, N>& out, F f)
+{
+    cob_parallel_for(out, [&](auto i) { out.set(i, f(in.get(i))); });
+}
+
+
+#endif // !defined(INC_COBPARALLEL)
@@ -0,0 +1,68 @@
+#include "cobparallel.hpp"
+
+#include <cassert>
+
+
+void parallel_for()
+{
+    static cobarray<int, 100000> a;
+    cob_parallel_for(a, [](auto i) {
+        using C = decltype(i);
+        static_assert(C::DD >= 0);
+        static_assert(C::GG < 100000);
+        a.set(i, i.get() * 2);
+    });
+    for (auto i: a.irange()) {
+        assert(a.get(i) == i.get() * 2);
+    }
+
+    cobarray<int, 5> b{};
+    cob_parallel_for(b, [&b](auto i) { b.set(i, 1); });
+    for (auto i: b.irange()) {
+        assert(b.get(i) == 1);
+    }
+}
+
+
+void parallel_transform()
+{
+    static cobarray<int, 10001> in;
+    static cobarray<long, 10001> out;
+    for (auto i: in.irange()) {
+        in.set(i, i.get());
+    }
+    for (int n = 0; n < 10; ++n) {
+        cob_parallel_transform(in, out, [n](int x) { return static_cast<long>(x) * n; });
+        for (auto i: in.irange()) {
+            assert(out.get(i) == static_cast<long>(i.get()) * n);
+        }
+    }
+}
+
+
+void pool_jobs()
+{
+    cobthreadpool pool(8);
+    assert(pool.size() == 8);
+    std::atomic<int> hits[64];
+    for (int n = 0; n < 20000; ++n) {
+        int const count = (n * 7) % 64 + 1;
+        for (int k = 0; k < count; ++k) {
+            hits[k] = 0;
+        }
+        pool.run(count, [&hits](int k) { ++hits[k]; });
+        for (int k = 0; k < count; ++k) {
+            assert(hits[k] == 1);
+        }
+    }
+}
+
+
+int main()
+{
+    pool_jobs();
+    parallel_for();
+    parallel_transform();
+
+    return 0;
+}
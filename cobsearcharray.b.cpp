@@ -0,0 +1,49 @@
+#include "cobsearcharray.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+// Big enough not to fit in the cache, which is where the layout matters
+constexpr int N = 1 << 22;
+
+
+template <class F> void bench(char const* name, std::vector<int> const& v, F f)
+{
+    long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int x : v) {
+        sum += f(x);
+    }
+    std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << t.count() / v.size() << " ns/search (" << sum << ")\n";
+}
+
+
+int main()
+{
+    auto a = std::make_unique<cobarray<int, N>>();
+    for (auto i : a->irange()) {
+        a->set(i, 3 * i.get());
+    }
+    auto s = std::make_unique<cobsearcharray<int, N>>(*a);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 3 * N);
+    std::vector<int> v(1 << 22);
+    for (auto& x : v) {
+        x = dist(rng);
+    }
+
+    auto sorted = a->span();
+    bench("sorted     ", v, [&sorted](int x) {
+        return std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin();
+    });
+    bench("eytzinger  ", v, [&s](int x) { return s->lower_bound(x).get(); });
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/* Compile time bound sorted arrays, in a layout for fast searching. For
+ * documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBSEARCHARRAY)
+#define INC_COBSEARCHARRAY
+
+
+#include "cobarray.hpp"
+#include "cobhlp.hpp"
+#include "cobsi.hpp"
+
+
+// A sorted array, kept in the Eytzinger (breadth first) order: the root of
+// the binary search tree is the first, then its children, then theirs...
+// So, the first few levels of the tree share a few cache lines and
+// searching can prefetch the levels below. Once made, can't be changed.
+template <class T, int N, class CMP = cobhlp::less<T>> class cobsearcharray {
+    static_assert(N > 0, "Array must have at least one element");
+
+public:
+    using value_type = T;
+    using index      = cobi<int, 0, N - 1>;
+    // A position in the sorted array, `N` for "not found"
+    using found = cobint<0, N>;
+
+    // `sorted` has to be sorted by `CMP`
+    explicit cobsearcharray(cobarray<T, N> const& sorted)
+    {
+        index i;
+        build(sorted, i, 1);
+    }
+
+    constexpr unsigned size() const noexcept { return N; }
+
+    // Position of the first element that is not less than `x`
+    found lower_bound(T const& x) const
+    {
+        unsigned k = 1;
+        while (k <= N) {
+#if defined(__GNUC__)
+            __builtin_prefetch(e + std::min(ahead * k, static_cast<unsigned>(N)));
+#endif
+            k = 2 * k + CMP{}(e[k], x);
+        }
+        // Going back up over the right turns, and the left one before them
+        k >>= cobhlp::lowest(~static_cast<std::uint64_t>(k)) + 1;
+        found rslt;
+        rslt.be((k == 0) ? N : pos[k].get());
+        return rslt;
+    }
+
+    // Position of an element that is equal to `x`
+    found find(T const& x) const
+    {
+        auto const i = lower_bound(x);
+        index j;
+        if (j.be(i.get()) && !CMP{}(x, get(j))) {
+            return i;
+        }
+        return cobic<N>;
+    }
+
+    // The element at `i` in the sorted array
+    T get(index i) const { return e[at[i.get()].get()]; }
+
+private:
+    // Elements in a cache line, prefetching that many levels below is
+    // prefetching the line with all the grandchildren of the grandchildren...
+    static constexpr unsigned ahead = (sizeof(T) < 64) ? 64 / sizeof(T) : 1;
+
+    void build(cobarray<T, N> const& sorted, index& i, int k)
+    {
+        if (k <= N) {
+            build(sorted, i, 2 * k);
+            e[k] = sorted.get(i);
+            pos[k] = i;
+            at[i.get()].be(k);
+            i.advance();
+            build(sorted, i, 2 * k + 1);
+        }
+    }
+
+    // Aligned, so that the `ahead` descendants prefetched are in one line
+    alignas(64) T e[N + 1];
+    cobsi<int, 0, N - 1> pos[N + 1];
+    cobsi<int, 1, N> at[N];
+};
+
+
+#endif // !defined(INC_COBSEARCHARRAY)
@@ -0,0 +1,61 @@
+#include "cobsearcharray.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+
+template <int N> void against_lower_bound()
+{
+    static cobarray<int, N> sorted;
+    for (auto i: sorted.irange()) {
+        sorted.set(i, 2 * i.get() + 10);
+    }
+    static cobsearcharray<int, N> s(sorted);
+    auto const first = sorted.span().begin();
+    auto const last = sorted.span().end();
+    for (int x = 0; x < 2 * N + 20; ++x) {
+        int const expected = static_cast<int>(std::lower_bound(first, last, x) - first);
+        assert(s.lower_bound(x).get() == expected);
+        auto f = s.find(x);
+        if ((x >= 10) && (x % 2 == 0) && (expected < N)) {
+            assert(f.get() == expected);
+        }
+        else {
+            assert(f == cobic<N>);
+        }
+    }
+    for (auto i: sorted.irange()) {
+        assert(s.get(i) == sorted.get(i));
+    }
+}
+
+
+void duplicates()
+{
+    cobarray<int, 7> sorted;
+    int const v[] = { 1, 2, 2, 2, 3, 5, 5 };
+    for (auto i: sorted.irange()) {
+        sorted.set(i, v[i.get()]);
+    }
+    cobsearcharray<int, 7> s(sorted);
+    assert(s.lower_bound(2) == cobic<1>);
+    assert(s.lower_bound(5) == cobic<5>);
+    assert(s.lower_bound(4) == cobic<5>);
+    assert(s.find(4) == cobic<7>);
+    assert(s.lower_bound(6) == cobic<7>);
+}
+
+
+int main()
+{
+    against_lower_bound<1>();
+    against_lower_bound<2>();
+    against_lower_bound<7>();
+    against_lower_bound<8>();
+    against_lower_bound<100>();
+    against_lower_bound<1023>();
+    against_lower_bound<1024>();
+    duplicates();
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+/* Compile time bound integers, stored in as few bytes as the bounds allow.
+ * For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBSI)
+#define INC_COBSI
+
+
+#include "cobi.hpp"
+#include "cobhlp.hpp"
+
+
+template <class T, T D, T G = D> struct cobsi {
+    static_assert(std::is_integral<T>::value, "T must be an integer type");
+    static_assert(D <= G, "Upper bound must be at least as high as lower");
+    static constexpr T DD = D;
+    static constexpr T GG = G;
+
+    using storage = typename cobhlp::fit<T, D, G>::type;
+
+    constexpr cobsi()
+        : i(D)
+    {
+    }
+
+    template <T PD, T PG>
+    constexpr cobsi(cobi<T, PD, PG> const& a)
+        : i(cobi<T, D, G>(a).get())
+    {
+    }
+
+    constexpr operator cobi<T, D, G>() const
+    {
+        cobi<T, D, G> r;
+        r.i = i;
+        return r;
+    }
+
+    constexpr bool be(T x)
+    {
+        if ((x >= D) && (x <= G)) {
+            i = x;
+            return true;
+        }
+        return false;
+    }
+
+    template <T D1, T G1> constexpr bool operator==(cobi<T, D1, G1> x) const
+    {
+        return cobi<T, D, G>(*this) == x;
+    }
+    template <T D1, T G1> constexpr bool operator!=(cobi<T, D1, G1> x) const
+    {
+        return !(*this == x);
+    }
+    constexpr bool operator==(cobsi x) const { return i == x.i; }
+    constexpr bool operator!=(cobsi x) const { return i != x.i; }
+
+    constexpr T get() const { return i; }
+
+private:
+    storage i;
+};
+
+
+#endif // !defined(INC_COBSI)
@@ -7,6 +7,7 @@
 #define INC_COBSKIPLIST
 
 #include "cobarray.hpp"
+#include "cobsi.hpp"
 
 #include "cobhlp.hpp"
 
@@ -31,7 +32,9 @@ struct cobskiplist
 
     using link = cobint<0, N>;
     using index = cobint<0, N - 1>;
-    using node = cobarray<link, max_level + 1>;
+    // As kept in nodes, in as few bytes as N allows
+    using slink = cobsi<int, 0, N>;
+    using node = cobarray<slink, max_level + 1>;
     using level = cobint<0, max_level>;
 
     static constexpr auto nil = cobic<N>;
@@ -381,7 +384,7 @@ private:
     node head;
     node next[N];
     link vacant;
-    cobarray<link, N> vacancy;
+    cobarray<slink, N> vacancy;
 
     // TODO parameterize RNG
     std::random_device rndev;
@@ -0,0 +1,206 @@
+/* Compile time bound structure of arrays. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBSOA)
+#define INC_COBSOA
+
+
+#include "cobarray.hpp"
+#include "cobhlp.hpp"
+
+#include <cassert>
+#include <tuple>
+#include <utility>
+
+
+// Like `cobarray<S, N>`, but each of the listed members of `S` (`M...`) is
+// kept in an array of its own. Members that are not listed are not kept,
+// so the whole `S` can be had (`get()`, `set()`, `fill()`, `grab()`) only
+// if all of its members are listed.
+template <class S, int N, auto... M> class cobsoa {
+    static_assert(sizeof...(M) > 0, "At least one member has to be kept");
+    static_assert((std::is_same_v<typename cobhlp::member<decltype(M)>::of, S> && ...),
+                  "Members have to be of S");
+
+    template <std::size_t K> using member_at = std::tuple_element_t<K, std::tuple<decltype(M)...>>;
+
+    template <auto P, auto Q> static constexpr bool same()
+    {
+        if constexpr (std::is_same_v<decltype(P), decltype(Q)>) {
+            return P == Q;
+        }
+        else {
+            return false;
+        }
+    }
+    template <auto P> static constexpr std::size_t position()
+    {
+        std::size_t k = 0;
+        std::size_t rslt = sizeof...(M);
+        ((same<P, M>() ? (rslt = k, ++k) : ++k), ...);
+        return rslt;
+    }
+    static constexpr bool whole = std::is_aggregate_v<S> && (cobhlp::fields<S>() == sizeof...(M));
+
+    template <class V> static constexpr bool kept = (std::is_same_v<decltype(M), V S::*> || ...);
+
+    template <auto P> static constexpr std::size_t at()
+    {
+        constexpr std::size_t k = position<P>();
+        static_assert(k < sizeof...(M), "Member is not kept");
+        return k;
+    }
+
+public:
+    using value_type = S;
+    using index      = cobi<int, 0, N - 1>;
+
+    // Gathers on construction, scatters (if not const) on destruction
+    template <class C> struct taken {
+        taken(C& r, index i)
+            : r_(r)
+            , i_(i)
+            , s_(r.get(i))
+        {
+        }
+        ~taken()
+        {
+            if constexpr (!std::is_const_v<C>) {
+                r_.set(i_, s_);
+            }
+        }
+
+        taken(taken&&) = delete;
+        taken& operator=(taken&&) = delete;
+
+        constexpr S const* operator->() const&& { return &s_; }
+        constexpr std::conditional_t<std::is_const_v<C>, S const*, S*> operator->() && { return &s_; }
+
+    private:
+        C& r_;
+        index i_;
+        S s_;
+    };
+
+    constexpr bool empty() const noexcept { return false; }
+    constexpr unsigned size() const noexcept { return N; }
+    constexpr unsigned max_size() const noexcept { return N; }
+
+    taken<cobsoa const> grab(index i) const { return { *this, i }; }
+    taken<cobsoa> grab(index i) { return { *this, i }; }
+
+    S get(index i) const
+    {
+        static_assert(whole, "Not all members of S are kept");
+        return gather(i, std::index_sequence_for<decltype(M)...>{});
+    }
+    S set(index i, S const& s)
+    {
+        static_assert(whole, "Not all members of S are kept");
+        scatter(i, s, std::index_sequence_for<decltype(M)...>{});
+        return s;
+    }
+
+    template <auto P> constexpr auto get(index i) const { return std::get<at<P>()>(d).get(i); }
+    template <auto P>
+    constexpr auto set(index i, typename cobhlp::member<decltype(P)>::type const& v)
+    {
+        return std::get<at<P>()>(d).set(i, v);
+    }
+
+    // Same as `cobarray`, but `m` has to be kept. If no kept member is of
+    // `V`, that won't compile, otherwise, it's an `assert()`. If `m` is
+    // known at compile time, this is as good as `get<m>()`.
+    template <class V> constexpr V get(index i, V S::*m) const
+    {
+        static_assert(kept<V>, "No member of this type is kept");
+        V rslt{};
+        [[maybe_unused]] bool const found = pick(m, [&](auto& a) { rslt = a.get(i); }, std::index_sequence_for<decltype(M)...>{});
+        assert(found && "Member is not kept");
+        return rslt;
+    }
+    template <class V> constexpr V set(index i, V S::*m, V const& v)
+    {
+        static_assert(kept<V>, "No member of this type is kept");
+        [[maybe_unused]] bool const found = pick(m, [&](auto& a) { a.set(i, v); }, std::index_sequence_for<decltype(M)...>{});
+        assert(found && "Member is not kept");
+        return v;
+    }
+
+    // All of one member, to scan it
+    template <auto P> constexpr auto span() { return std::get<at<P>()>(d).span(); }
+    template <auto P> constexpr auto span() const { return std::get<at<P>()>(d).span(); }
+
+    template <auto P> constexpr cobarray<typename cobhlp::member<decltype(P)>::type, N>& array()
+    {
+        return std::get<at<P>()>(d);
+    }
+    template <auto P>
+    constexpr cobarray<typename cobhlp::member<decltype(P)>::type, N> const& array() const
+    {
+        return std::get<at<P>()>(d);
+    }
+
+    void fill(S const& s)
+    {
+        static_assert(whole, "Not all members of S are kept");
+        fill(s, std::index_sequence_for<decltype(M)...>{});
+    }
+
+    constexpr cobirange<int, 0, N - 1> irange() const { return cobirange<int, 0, N - 1>{}; }
+
+private:
+    template <std::size_t... K> S gather(index i, std::index_sequence<K...>) const
+    {
+        S rslt{};
+        ((rslt.*M = std::get<K>(d).get(i)), ...);
+        return rslt;
+    }
+    template <std::size_t... K> void scatter(index i, S const& s, std::index_sequence<K...>)
+    {
+        (std::get<K>(d).set(i, s.*M), ...);
+    }
+    template <std::size_t... K> void fill(S const& s, std::index_sequence<K...>)
+    {
+        (std::get<K>(d).fill(s.*M), ...);
+    }
+    template <class P, class F, std::size_t... K>
+    constexpr bool pick(P m, F f, std::index_sequence<K...>) const
+    {
+        return (pick_one<K>(m, f) || ...);
+    }
+    template <class P, class F, std::size_t... K>
+    constexpr bool pick(P m, F f, std::index_sequence<K...>)
+    {
+        return (pick_one<K>(m, f) || ...);
+    }
+    template <std::size_t K, class P, class F> constexpr bool pick_one(P m, F& f) const
+    {
+        if constexpr (std::is_same_v<P, member_at<K>>) {
+            if (m == std::get<K>(members)) {
+                f(std::get<K>(d));
+                return true;
+            }
+        }
+        return false;
+    }
+    template <std::size_t K, class P, class F> constexpr bool pick_one(P m, F& f)
+    {
+        if constexpr (std::is_same_v<P, member_at<K>>) {
+            if (m == std::get<K>(members)) {
+                f(std::get<K>(d));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static constexpr std::tuple<decltype(M)...> members{ M... };
+
+    std::tuple<cobarray<typename cobhlp::member<decltype(M)>::type, N>...> d;
+};
+
+
+#endif // !defined(INC_COBSOA)
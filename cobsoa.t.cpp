@@ -0,0 +1,89 @@
+#include "cobsoa.hpp"
+
+#include <numeric>
+#include <cassert>
+
+
+struct session {
+    int id;
+    float load;
+    char state;
+    long bytes;
+};
+
+using sessions = cobsoa<session, 100, &session::id, &session::load, &session::state, &session::bytes>;
+
+// Keeps only some of the members
+using loads = cobsoa<session, 100, &session::id, &session::load>;
+
+
+void members()
+{
+    static sessions s;
+    s.fill({ 1, 0.5f, 'x', 10 });
+    assert(s.get(cobic<99>).id == 1);
+    assert(s.get(cobic<99>).state == 'x');
+
+    s.set(cobic<3>, { 3, 1.5f, 'y', 30 });
+    session x = s.get(cobic<3>);
+    assert(x.id == 3);
+    assert(x.load == 1.5f);
+    assert(x.bytes == 30);
+    assert(x.state == 'y');
+
+    assert(s.get(cobic<3>, &session::bytes) == 30);
+    s.set(cobic<4>, &session::bytes, 40L);
+    assert(s.get(cobic<4>, &session::bytes) == 40);
+    assert(s.get<&session::bytes>(cobic<4>) == 40);
+    s.set<&session::id>(cobic<4>, 4);
+    assert(s.get(cobic<4>, &session::id) == 4);
+
+    s.set(cobic<4>, &session::state, 'z');
+    assert(s.get(cobic<4>, &session::state) == 'z');
+
+    static loads l;
+    l.set(cobic<4>, &session::load, 2.5f);
+    assert(l.get(cobic<4>, &session::load) == 2.5f);
+    assert(l.get<&session::id>(cobic<4>) == 0);
+    // l.get<&session::state>(cobic<4>); // Won't compile
+    // l.get(cobic<4>, &session::state); // Won't compile, no char is kept
+    // l.get(cobic<4>); // Won't compile, not all members are kept
+    // l.fill({ 1, 0.5f, 'x', 10 }); // Won't compile, same
+}
+
+
+void grabs()
+{
+    static sessions s;
+    s.fill({ 0, 0.0f, 0, 0 });
+    s.grab(cobic<7>)->bytes += 77;
+    assert(s.get(cobic<7>, &session::bytes) == 77);
+
+    sessions const& c = s;
+    assert(c.grab(cobic<7>)->bytes == 77);
+}
+
+
+void spans()
+{
+    static sessions s;
+    for (auto i: s.irange()) {
+        s.set(i, { i.get(), 0.0f, 0, 2L * i.get() });
+    }
+    auto b = s.span<&session::bytes>();
+    static_assert(std::is_same_v<decltype(b), cobspan<long, 100>>);
+    assert(std::accumulate(b.begin(), b.end(), 0L) == 9900);
+    auto i = s.span<&session::id>();
+    assert(std::accumulate(i.begin(), i.end(), 0) == 4950);
+    assert(s.array<&session::id>().get(cobic<5>) == 5);
+}
+
+
+int main()
+{
+    members();
+    grabs();
+    spans();
+
+    return 0;
+}
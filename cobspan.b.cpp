@@ -0,0 +1,49 @@
+#include "cobarray.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <numeric>
+
+
+constexpr int N = 1 << 16;
+constexpr int R = 2000;
+
+
+template <class F> void bench(char const* name, F f)
+{
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < R; ++r) {
+        sum += f();
+    }
+    std::chrono::duration<double, std::nano> t = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << t.count() / (static_cast<double>(R) * N) << " ns/element (" << sum << ")\n";
+}
+
+
+int main()
+{
+    static cobarray<int, N> a;
+    static cobarray<int, N> b;
+    for (auto i: a.irange()) {
+        a.set(i, i.get() & 0xFF);
+    }
+
+    bench("accumulate iterator", [] { return std::accumulate(a.begin(), a.end(), 0); });
+    bench("accumulate span    ", [] {
+        auto s = a.span();
+        return std::accumulate(s.begin(), s.end(), 0);
+    });
+    bench("transform iterator ", [] {
+        std::transform(a.begin(), a.end(), b.begin(), [](int x) { return x * 3 + 1; });
+        return b.get(cobic<N - 1>);
+    });
+    bench("transform span     ", [] {
+        auto s = a.span();
+        auto t = b.span();
+        std::transform(s.begin(), s.end(), t.begin(), [](int x) { return x * 3 + 1; });
+        return b.get(cobic<N - 1>);
+    });
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+/* Compile time bound spans. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBSPAN)
+#define INC_COBSPAN
+
+
+#include "cobi.hpp"
+
+#include <type_traits>
+
+
+// A view of `N` contiguous `T`s, which are known to be there when it's
+// made, so it doesn't check anything afterwards and iterators are plain
+// pointers. Get one from `cobarray::span()` or `cobmatrix::span()`.
+template <class T, int N> class cobspan {
+    static_assert(N > 0, "Span must have at least one element");
+
+public:
+    using value_type      = std::remove_const_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T*;
+    using reference       = T&;
+    using iterator        = T*;
+
+    using index = cobi<int, 0, N - 1>;
+
+    constexpr cobspan(T (&a)[N])
+        : p(a)
+    {
+    }
+    template <class U, class = std::enable_if_t<std::is_same_v<T, U const>>>
+    constexpr cobspan(cobspan<U, N> x)
+        : p(x.data())
+    {
+    }
+
+    constexpr bool     empty() const noexcept { return false; }
+    static constexpr unsigned size() noexcept { return N; }
+    constexpr unsigned max_size() const noexcept { return N; }
+
+    constexpr T& operator[](index i) const { return p[i.get()]; }
+    constexpr value_type get(index i) const { return p[i.get()]; }
+    constexpr value_type set(index i, value_type const& t) const { return p[i.get()] = t; }
+
+    // `L` elements from `from`, which has to leave room for all of them
+    template <int L, int K, int G> constexpr cobspan<T, L> sub(cobi<int, K, G> from) const
+    {
+        static_assert(K >= 0, "Sub-span starts before the span");
+        static_assert(G + L <= N, "Sub-span might end after the span");
+        return cobspan<T, L>::at(p + from.get());
+    }
+
+    constexpr T* data() const noexcept { return p; }
+    constexpr T* begin() const noexcept { return p; }
+    constexpr T* end() const noexcept { return p + N; }
+
+    constexpr cobirange<int, 0, N - 1> irange() const { return cobirange<int, 0, N - 1>{}; }
+
+private:
+    // For those that know there are `N` elements at `p_`
+    static constexpr cobspan at(T* p_) { return cobspan{ p_, 0 }; }
+    constexpr cobspan(T* p_, int)
+        : p(p_)
+    {
+    }
+
+    template <class U, int L> friend class cobspan;
+    template <class U, int L> friend struct cobarray;
+    template <class U, int R, int C, class L> friend struct cobmatrix;
+    template <class U, int... D> friend class cobtensorview;
+
+    T* p;
+};
+
+
+// A view of `N` `T`s, `S` apart, like a column of a `cobmatrix`. Iterators
+// keep the position, not the pointer, so the end is never out of the
+// memory that's viewed.
+template <class T, int N, int S> class cobstride {
+    static_assert(N > 0, "View must have at least one element");
+    static_assert(S > 0, "Elements must be apart");
+
+public:
+    using value_type      = std::remove_const_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T*;
+    using reference       = T&;
+
+    using index = cobi<int, 0, N - 1>;
+
+    class iterator {
+    public:
+        using value_type        = std::remove_const_t<T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr iterator()
+            : p(nullptr)
+            , k(0)
+        {
+        }
+        constexpr iterator(T* p_, difference_type k_)
+            : p(p_)
+            , k(k_)
+        {
+        }
+
+        constexpr iterator& operator++()
+        {
+            ++k;
+            return *this;
+        }
+        constexpr iterator& operator--()
+        {
+            --k;
+            return *this;
+        }
+        constexpr iterator operator+(difference_type x) const { return { p, k + x }; }
+        constexpr iterator operator-(difference_type x) const { return { p, k - x }; }
+        constexpr iterator& operator+=(difference_type x)
+        {
+            k += x;
+            return *this;
+        }
+        constexpr iterator& operator-=(difference_type x)
+        {
+            k -= x;
+            return *this;
+        }
+        constexpr difference_type operator-(iterator const& x) const { return k - x.k; }
+
+        constexpr T& operator*() const { return p[k * S]; }
+        constexpr T* operator->() const { return p + k * S; }
+        constexpr T& operator[](difference_type x) const { return p[(k + x) * S]; }
+
+        constexpr bool operator==(iterator const& x) const { return k == x.k; }
+        constexpr bool operator!=(iterator const& x) const { return k != x.k; }
+        constexpr bool operator<(iterator const& x) const { return k < x.k; }
+        constexpr bool operator<=(iterator const& x) const { return k <= x.k; }
+        constexpr bool operator>(iterator const& x) const { return k > x.k; }
+        constexpr bool operator>=(iterator const& x) const { return k >= x.k; }
+
+    private:
+        T*              p;
+        difference_type k;
+    };
+
+    constexpr bool     empty() const noexcept { return false; }
+    static constexpr unsigned size() noexcept { return N; }
+    constexpr unsigned max_size() const noexcept { return N; }
+
+    constexpr T&         operator[](index i) const { return p[i.get() * S]; }
+    constexpr value_type get(index i) const { return p[i.get() * S]; }
+    constexpr value_type set(index i, value_type const& t) const { return p[i.get() * S] = t; }
+
+    constexpr iterator begin() const noexcept { return { p, 0 }; }
+    constexpr iterator end() const noexcept { return { p, N }; }
+
+    constexpr cobirange<int, 0, N - 1> irange() const { return cobirange<int, 0, N - 1>{}; }
+
+private:
+    static constexpr cobstride at(T* p_) { return cobstride{ p_ }; }
+    explicit constexpr cobstride(T* p_)
+        : p(p_)
+    {
+    }
+
+    template <class U, int R, int C, class L> friend struct cobmatrix;
+
+    T* p;
+};
+
+
+#endif // !defined(INC_COBSPAN)
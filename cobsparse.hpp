@@ -0,0 +1,224 @@
+/* Compile time bound sparse matrices. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBSPARSE)
+#define INC_COBSPARSE
+
+
+#include "cobarray.hpp"
+#include "cobsi.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+
+// An `M`x`N` matrix of at most `NNZ` non-zero elements, in the compressed
+// sparse row (CSR) form: the non-zero elements, row by row, each with its
+// column, and where each row starts. Columns and row starts are kept as
+// `cobsi`, so they are always in range, and take as few bytes as they can.
+template <class T, int M, int N, int NNZ> class cobsparse {
+    static_assert(M > 0, "Matrix must have at least one row");
+    static_assert(N > 0, "Matrix must have at least one column");
+    static_assert(NNZ > 0, "Matrix must have room for at least one element");
+
+public:
+    using value_type = T;
+    using row        = cobi<int, 0, M - 1>;
+    using column     = cobi<int, 0, N - 1>;
+    struct index {
+        row    irow;
+        column icolumn;
+    };
+    struct triplet {
+        row    irow;
+        column icolumn;
+        T      value;
+    };
+
+    // An element of a row, as seen when going through it
+    template <class U> struct entry {
+        column icolumn;
+        U&     value;
+    };
+    template <class U, class S> class entries {
+    public:
+        class iterator {
+        public:
+            using value_type        = entry<U>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = entry<U>;
+            using iterator_category = std::input_iterator_tag;
+
+            iterator(S* s_, int k_)
+                : s(s_)
+                , k(k_)
+            {
+            }
+            entry<U> operator*() const { return { s->col[k], s->val[k] }; }
+            iterator& operator++()
+            {
+                ++k;
+                return *this;
+            }
+            bool operator==(iterator const& x) const { return k == x.k; }
+            bool operator!=(iterator const& x) const { return k != x.k; }
+
+        private:
+            S*  s;
+            int k;
+        };
+
+        iterator begin() const { return { s, first }; }
+        iterator end() const { return { s, last }; }
+
+    private:
+        entries(S* s_, int first_, int last_)
+            : s(s_)
+            , first(first_)
+            , last(last_)
+        {
+        }
+        friend class cobsparse;
+
+        S*  s;
+        int first;
+        int last;
+    };
+
+    constexpr unsigned size() const noexcept { return M * N; }
+    static constexpr unsigned capacity() noexcept { return NNZ; }
+    // Number of elements kept, which can be zero, if so set
+    cobint<0, NNZ> nonzeros() const { return start[M]; }
+
+    // Makes the matrix (anew) of the elements in `[first, last)`, which
+    // can be in any order. Duplicates are summed. Fails, leaving the
+    // matrix empty, if there are more than `NNZ` elements.
+    template <class It> bool build(It first, It last)
+    {
+        clear();
+        if (std::distance(first, last) > NNZ) {
+            return false;
+        }
+        // Counting sort by row, with `start` first counting, then pointing
+        // to where the next element of a row goes, and finally back to
+        // where rows start, so it needs no memory of its own
+        for (auto t = first; t != last; ++t) {
+            start[t->irow.get() + 1].be(start[t->irow.get() + 1].get() + 1);
+        }
+        for (int i = 0; i < M; ++i) {
+            start[i + 1].be(start[i + 1].get() + start[i].get());
+        }
+        for (auto t = first; t != last; ++t) {
+            int const k = start[t->irow.get()].get();
+            col[k]      = t->icolumn;
+            val[k]      = t->value;
+            start[t->irow.get()].be(k + 1);
+        }
+        for (int i = M; i > 0; --i) {
+            start[i] = start[i - 1];
+        }
+        start[0] = cobic<0>;
+        // Sort each row by column, summing the duplicates
+        int kept = 0;
+        for (int i = 0; i < M; ++i) {
+            int const b = start[i].get();
+            int const e = start[i + 1].get();
+            sort_row(b, e);
+            start[i].be(kept);
+            for (int k = b; k < e; ++k) {
+                if ((kept > start[i].get()) && (col[kept - 1] == col[k])) {
+                    val[kept - 1] = val[kept - 1] + val[k];
+                }
+                else {
+                    col[kept] = col[k];
+                    val[kept] = val[k];
+                    ++kept;
+                }
+            }
+        }
+        start[M].be(kept);
+        return true;
+    }
+    template <int K> bool build(triplet const (&t)[K]) { return build(t, t + K); }
+
+    void clear()
+    {
+        for (auto& s: start) {
+            s = cobic<0>;
+        }
+    }
+
+    // Element at `i`, `T{}` if there is none
+    T get(index i) const
+    {
+        auto const b = col + start[i.irow.get()].get();
+        auto const e = col + start[i.irow.get() + 1].get();
+        auto const p = std::lower_bound(b, e, i.icolumn, [](auto const& c, column x) {
+            return c.get() < x.get();
+        });
+        if ((p != e) && (*p == i.icolumn)) {
+            return val[p - col];
+        }
+        return T{};
+    }
+
+    // The non-zero elements in row `r`, from the leftmost
+    entries<T, cobsparse> in_row(row r) { return { this, start[r.get()].get(), start[r.get() + 1].get() }; }
+    entries<T const, cobsparse const> in_row(row r) const
+    {
+        return { this, start[r.get()].get(), start[r.get() + 1].get() };
+    }
+
+    // `y = A x`. The inner loop reads `x` at the columns of the elements,
+    // which, on CPUs that have one, compilers can vectorize with a gather.
+    void multiply(cobarray<T, N> const& x, cobarray<T, M>& y) const
+    {
+        auto const px = x.span().data();
+        for (auto i: y.irange()) {
+            int const b = start[i.get()].get();
+            int const e = start[i.get() + 1].get();
+            T sum{};
+            for (int k = b; k < e; ++k) {
+                sum += val[k] * px[col[k].get()];
+            }
+            y.set(i, sum);
+        }
+    }
+
+private:
+    void sort_row(int b, int e)
+    {
+        // Insertion sort, rows are expected to be short
+        for (int k = b + 1; k < e; ++k) {
+            auto const c = col[k];
+            auto const v = val[k];
+            int j = k;
+            for (; (j > b) && (col[j - 1].get() > c.get()); --j) {
+                col[j] = col[j - 1];
+                val[j] = val[j - 1];
+            }
+            col[j] = c;
+            val[j] = v;
+        }
+    }
+
+    cobsi<int, 0, NNZ>   start[M + 1];
+    cobsi<int, 0, N - 1> col[NNZ];
+    T                    val[NNZ];
+};
+
+
+// `A x`
+template <class T, int M, int N, int NNZ>
+cobarray<T, M> cob_spmv(cobsparse<T, M, N, NNZ> const& a, cobarray<T, N> const& x)
+{
+    cobarray<T, M> y;
+    a.multiply(x, y);
+    return y;
+}
+
+
+#endif // !defined(INC_COBSPARSE)
@@ -0,0 +1,92 @@
+#include "cobsparse.hpp"
+
+#include <vector>
+#include <cassert>
+
+
+using sparse = cobsparse<double, 4, 300, 8>;
+
+
+void build()
+{
+    static sparse a;
+    assert(a.nonzeros() == cobic<0>);
+    sparse::triplet t[] = {
+        { cobic<2>, cobic<299>, 1.0 },
+        { cobic<0>, cobic<5>, 2.0 },
+        { cobic<2>, cobic<3>, 3.0 },
+        { cobic<2>, cobic<299>, 0.5 },
+        { cobic<3>, cobic<0>, 4.0 },
+    };
+    assert(a.build(t));
+    assert(a.nonzeros() == cobic<4>);
+    assert(a.get({ cobic<2>, cobic<299> }) == 1.5);
+    assert(a.get({ cobic<2>, cobic<3> }) == 3.0);
+    assert(a.get({ cobic<0>, cobic<5> }) == 2.0);
+    assert(a.get({ cobic<1>, cobic<5> }) == 0.0);
+    assert(a.get({ cobic<0>, cobic<4> }) == 0.0);
+
+    std::vector<sparse::triplet> many(9, { cobic<0>, cobic<0>, 1.0 });
+    assert(!a.build(many.begin(), many.end()));
+    assert(a.nonzeros() == cobic<0>);
+    assert(a.get({ cobic<2>, cobic<3> }) == 0.0);
+
+    static_assert(sizeof(cobsparse<float, 100, 200, 250>) == 101 + 250 + 250 * sizeof(float) + 1);
+}
+
+
+void rows()
+{
+    static sparse a;
+    sparse::triplet t[] = {
+        { cobic<1>, cobic<7>, 7.0 },
+        { cobic<1>, cobic<2>, 2.0 },
+        { cobic<1>, cobic<5>, 5.0 },
+    };
+    assert(a.build(t));
+    std::vector<int> cols;
+    for (auto e: a.in_row(cobic<1>)) {
+        cols.push_back(e.icolumn.get());
+        e.value *= 2;
+    }
+    assert((cols == std::vector<int>{ 2, 5, 7 }));
+    assert(a.get({ cobic<1>, cobic<5> }) == 10.0);
+    sparse const& c = a;
+    int n = 0;
+    for (auto e: c.in_row(cobic<0>)) {
+        n += static_cast<int>(e.value);
+    }
+    assert(n == 0);
+}
+
+
+void spmv()
+{
+    static cobsparse<int, 3, 5, 6> a;
+    cobsparse<int, 3, 5, 6>::triplet t[] = {
+        { cobic<0>, cobic<0>, 1 },
+        { cobic<0>, cobic<4>, 2 },
+        { cobic<1>, cobic<2>, 3 },
+        { cobic<2>, cobic<1>, 4 },
+        { cobic<2>, cobic<3>, 5 },
+    };
+    assert(a.build(t));
+    cobarray<int, 5> x;
+    for (auto i: x.irange()) {
+        x.set(i, i.get() + 1);
+    }
+    auto y = cob_spmv(a, x);
+    assert(y.get(cobic<0>) == 1 * 1 + 2 * 5);
+    assert(y.get(cobic<1>) == 3 * 3);
+    assert(y.get(cobic<2>) == 4 * 2 + 5 * 4);
+}
+
+
+int main()
+{
+    build();
+    rows();
+    spmv();
+
+    return 0;
+}
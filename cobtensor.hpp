@@ -0,0 +1,136 @@
+/* Compile time bound tensors. For documentation, see README.md.
+ * (C) Srdjan Veljkovic
+ * License: MIT (see LICENSE)
+ */
+
+#if !defined(INC_COBTENSOR)
+#define INC_COBTENSOR
+
+
+#include "cobi.hpp"
+#include "cobhlp.hpp"
+#include "cobspan.hpp"
+
+#include <tuple>
+
+
+template <class T, int... D> class cobtensorview;
+
+// A view of a `D0`x`R...` tensor, the last dimension being the innermost
+// (elements along it are one after the other). Slicing gives a view of one
+// dimension less, all the way to the innermost, which can be a `cobspan`.
+template <class T, int D0, int... R> class cobtensorview<T, D0, R...> {
+    static_assert((D0 > 0) && ((R > 0) && ...), "Each dimension must have at least one element");
+
+public:
+    static constexpr int rank   = 1 + sizeof...(R);
+    static constexpr int count  = D0 * (R * ... * 1);
+    static constexpr int stride = count / D0;
+
+    using value_type = std::remove_const_t<T>;
+    using index      = std::tuple<cobi<int, 0, D0 - 1>, cobi<int, 0, R - 1>...>;
+
+    static constexpr int at(cobi<int, 0, D0 - 1> i, cobi<int, 0, R - 1>... r)
+    {
+        if constexpr (sizeof...(R) > 0) {
+            return i.get() * stride + cobtensorview<T, R...>::at(r...);
+        }
+        else {
+            return i.get();
+        }
+    }
+
+    constexpr T& operator()(cobi<int, 0, D0 - 1> i, cobi<int, 0, R - 1>... r) const { return p[at(i, r...)]; }
+    constexpr value_type get(cobi<int, 0, D0 - 1> i, cobi<int, 0, R - 1>... r) const { return p[at(i, r...)]; }
+    constexpr value_type get(index const& i) const
+    {
+        return p[std::apply([](auto... k) { return at(k...); }, i)];
+    }
+    constexpr value_type set(index const& i, value_type const& t) const
+    {
+        return p[std::apply([](auto... k) { return at(k...); }, i)] = t;
+    }
+
+    // Fixes the outermost dimension at `i`
+    constexpr auto slice(cobi<int, 0, D0 - 1> i) const
+    {
+        static_assert(sizeof...(R) > 0, "Can't slice a single dimension");
+        return cobtensorview<T, R...>{ p + i.get() * stride };
+    }
+
+    // The innermost dimension, with all the others fixed
+    template <class... I> constexpr auto inner(I... i) const
+    {
+        static_assert(sizeof...(I) + 1 == rank, "All but the innermost dimension must be given");
+        if constexpr (sizeof...(I) == 0) {
+            return span();
+        }
+        else {
+            return inner_of(i...);
+        }
+    }
+
+    // All of it, as it is in memory
+    constexpr cobspan<T, count> span() const { return cobspan<T, count>::at(p); }
+
+private:
+    explicit constexpr cobtensorview(T* p_)
+        : p(p_)
+    {
+    }
+
+    template <class... I> constexpr auto inner_of(cobi<int, 0, D0 - 1> i, I... rest) const
+    {
+        return slice(i).inner(rest...);
+    }
+
+    template <class U, int... E> friend class cobtensorview;
+    template <class U, int... E> friend class cobtensor;
+
+    T* p;
+};
+
+
+// A tensor of `D...` dimensions, all kept in one array
+template <class T, int... D> class cobtensor {
+    static_assert(sizeof...(D) > 0, "Tensor must have at least one dimension");
+
+public:
+    using view       = cobtensorview<T, D...>;
+    using const_view = cobtensorview<T const, D...>;
+
+    static constexpr int rank  = view::rank;
+    static constexpr int count = view::count;
+
+    using value_type = T;
+    using index      = typename view::index;
+
+    constexpr bool     empty() const noexcept { return false; }
+    constexpr unsigned size() const noexcept { return count; }
+
+    static constexpr int at(cobi<int, 0, D - 1>... i) { return view::at(i...); }
+
+    constexpr T& operator()(cobi<int, 0, D - 1>... i) { return d[at(i...)]; }
+    constexpr T const& operator()(cobi<int, 0, D - 1>... i) const { return d[at(i...)]; }
+    constexpr T get(cobi<int, 0, D - 1>... i) const { return d[at(i...)]; }
+    constexpr T get(index const& i) const { return all().get(i); }
+    constexpr T set(index const& i, T const& t) { return all().set(i, t); }
+
+    constexpr view       all() { return view{ d }; }
+    constexpr const_view all() const { return const_view{ d }; }
+
+    template <class I> constexpr auto slice(I i) { return all().slice(i); }
+    template <class I> constexpr auto slice(I i) const { return all().slice(i); }
+    template <class... I> constexpr auto inner(I... i) { return all().inner(i...); }
+    template <class... I> constexpr auto inner(I... i) const { return all().inner(i...); }
+    constexpr cobspan<T, count>       span() { return all().span(); }
+    constexpr cobspan<T const, count> span() const { return all().span(); }
+
+    void fill(T const& v) { cobhlp::fill(d, count, v); }
+
+private:
+    T d[count];
+};
+
+
+#endif // !defined(INC_COBTENSOR)
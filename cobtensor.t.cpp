@@ -0,0 +1,69 @@
+#include "cobtensor.hpp"
+
+#include <numeric>
+#include <cassert>
+
+
+void access()
+{
+    static cobtensor<int, 3, 4, 5> t;
+    static_assert(decltype(t)::rank == 3);
+    static_assert(decltype(t)::count == 60);
+    static_assert(sizeof(t) == 60 * sizeof(int));
+    static_assert(decltype(t)::at(cobic<1>, cobic<2>, cobic<3>) == 1 * 20 + 2 * 5 + 3);
+
+    for (auto i: cobirange<int, 0, 2>{}) {
+        for (auto j: cobirange<int, 0, 3>{}) {
+            for (auto k: cobirange<int, 0, 4>{}) {
+                t(i, j, k) = i.get() * 100 + j.get() * 10 + k.get();
+            }
+        }
+    }
+    assert(t.get(cobic<2>, cobic<3>, cobic<4>) == 234);
+    using I = decltype(t)::index;
+    I x{ cobic<1>, cobic<0>, cobic<2> };
+    assert(t.get(x) == 102);
+    t.set(x, -1);
+    assert(t(cobic<1>, cobic<0>, cobic<2>) == -1);
+    // t.get(cobic<3>, cobic<0>, cobic<0>); // Won't compile, out of range
+}
+
+
+void slices()
+{
+    static cobtensor<int, 2, 3, 4, 5> t;
+    int n = 0;
+    for (auto& x: t.span()) {
+        x = n++;
+    }
+    auto s = t.slice(cobic<1>);
+    static_assert(decltype(s)::rank == 3);
+    assert(s.get(cobic<0>, cobic<0>, cobic<0>) == 60);
+    auto ss = s.slice(cobic<2>);
+    assert(ss.get(cobic<3>, cobic<4>) == 60 + 40 + 15 + 4);
+    ss(cobic<0>, cobic<0>) = -5;
+    assert(t.get(cobic<1>, cobic<2>, cobic<0>, cobic<0>) == -5);
+
+    auto in = t.inner(cobic<1>, cobic<1>, cobic<1>);
+    static_assert(std::is_same_v<decltype(in), cobspan<int, 5>>);
+    assert(std::accumulate(in.begin(), in.end(), 0) == 5 * (60 + 20 + 5) + 10);
+
+    cobtensor<int, 2, 3, 4, 5> const& c = t;
+    auto ci = c.inner(cobic<0>, cobic<0>, cobic<0>);
+    static_assert(std::is_same_v<decltype(ci), cobspan<int const, 5>>);
+    assert(ci[cobic<4>] == 4);
+
+    cobtensor<float, 7> v;
+    v.fill(1.5f);
+    auto vi = v.inner();
+    assert(vi.get(cobic<6>) == 1.5f);
+}
+
+
+int main()
+{
+    access();
+    slices();
+
+    return 0;
+}
@@ -5,6 +5,7 @@
 #include <iostream>
 
 #include "cobarray.hpp"
+#include "cobsi.hpp"
 
 template <int N, int D, int G>
 void print(std::ostream& out, cobarray<cobint<D, G>, N> const &l)
@@ -21,5 +22,15 @@ void print(cobarray<cobint<D, G>, N> const &l) {
     print(std::cout, l);
 }
 
+template <int N, int D, int G>
+void print(std::ostream& out, cobarray<cobsi<int, D, G>, N> const &l)
+{
+    for (auto &x : l)
+    {
+        std::cout << x.get() << " ";
+    }
+    std::cout << "." << std::endl;
+}
+
 
 #endif // !defined(INC_COBTESTHELP)
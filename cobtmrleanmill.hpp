@@ -9,6 +9,7 @@
 
 #include "cobarray.hpp"
 #include "cobmatrix.hpp"
+#include "cobmod.hpp"
 
 
 template <class ID, int N, class U, class NULIFY, unsigned LVL = 5, unsigned DIM = 64>
@@ -21,12 +22,13 @@ class cobtmrleanmill {
 
     using level    = cobint<0, LVL - 1>;
     using lvlindex = cobint<0, DIM - 1>;
+    using ring     = cobmod<DIM>;
     using spoke    = cobarray<ID, spokedim>;
     using spokepos = cobint<0, spokedim>;
 
     spoke                         timers[LVL][DIM];
     cobmatrix<unsigned, LVL, DIM> active;
-    cobarray<lvlindex, LVL>       next;
+    cobarray<ring, LVL>           next;
 
 public:
     using tmrID = ID;
@@ -49,18 +51,18 @@ public:
 
     constexpr index spoke_from_duration(U duration)
     {
-        level    lvl;
+        index    rslt{ level::greatest(), cobic<0>, spokepos::greatest() };
         unsigned d = duration.count();
-        do {
+        cob_for<level>([&](auto lvl) {
             lvlindex idx;
             if (idx.be(d)) {
-                d = (d + next.get(lvl).get()) % (idx.greatest().get() + 1);
-                idx.be(d);
-                return { lvl, idx, cobic<0> };
+                rslt = { lvl, ring{ idx } + next.get(lvl), cobic<0> };
+                return false;
             }
             d = d / DIM;
-        } while (lvl.advance());
-        return { lvl, cobic<0>, spokepos::greatest() };
+            return true;
+        });
+        return rslt;
     }
 
     constexpr index start(ID id, U duration)
@@ -117,7 +119,8 @@ public:
                     nlf(*p);
                     return rslt;
                 }
-                if (!ispoke.advance()) {
+                ++ispoke;
+                if (ispoke == cobic<0>) {
                     auto next_lvl = lvl;
                     if (next_lvl.advance()) {
                         auto nxt_lvl_idx = next.get(next_lvl);
@@ -132,7 +135,6 @@ public:
 			    }
                         }
                     }
-		    ispoke = cobic<0>;
                 }
             } while (ispoke != next.get(lvl));
         } while (lvl.advance());
@@ -142,8 +144,7 @@ public:
     template <class F> void process_expired(U elapsed, F f)
     {
         for (U i{ 0 }; i < elapsed; ++i) {
-            level lvl;
-            do {
+            cob_for<level>([&](auto lvl) {
                 auto ispoke = next.get(lvl);
                 auto p      = timers[lvl.get()][ispoke.get()].begin();
                 for (unsigned j = 0; j < active.get({ lvl, ispoke }); ++j) {
@@ -152,12 +153,9 @@ public:
                 }
                 active.set({ lvl, ispoke }, 0);
 
-                if (ispoke.advance()) {
-                    next.set(lvl, ispoke);
-                    break;
-                }
-                next.set(lvl, cobic<0>);
-            } while (lvl.advance());
+                next.set(lvl, ++ispoke);
+                return ispoke == cobic<0>;
+            });
         }
     }
 
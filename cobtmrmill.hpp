@@ -9,6 +9,7 @@
 
 #include "coblist.hpp"
 #include "cobhlp.hpp"
+#include "cobmod.hpp"
 
 
 template <class ID, int N, class U, unsigned LVL = 5, unsigned DIM = 64>
@@ -21,10 +22,11 @@ class cobtmrmill {
 
     using level    = cobint<0, LVL - 1>;
     using lvlindex = cobint<0, DIM - 1>;
+    using ring     = cobmod<DIM>;
     using spoke    = coblist<ID, spokedim>;
 
     spoke                   timers[LVL][DIM];
-    cobarray<lvlindex, LVL> next;
+    cobarray<ring, LVL>     next;
 
 public:
     using tmrID = ID;
@@ -43,18 +45,18 @@ public:
 
     constexpr index spoke_from_duration(U duration)
     {
-        level    lvl;
+        index    rslt{ level::greatest(), cobic<0>, spoke::nil };
         unsigned d = duration.count();
-        do {
+        cob_for<level>([&](auto lvl) {
             lvlindex idx;
             if (idx.be(d)) {
-                d = (d + next.get(lvl).get()) % (idx.greatest().get() + 1);
-                idx.be(d);
-                return { lvl, idx, cobic<0> };
+                rslt = { lvl, ring{ idx } + next.get(lvl), cobic<0> };
+                return false;
             }
             d = d / DIM;
-        } while (lvl.advance());
-        return { lvl, cobic<0>, spoke::nil };
+            return true;
+        });
+        return rslt;
     }
 
     constexpr index start(ID id, U duration)
@@ -95,7 +97,8 @@ public:
                     list.erase(list.lfront());
                     return rslt;
                 }
-                if (!ispoke.advance()) {
+                ++ispoke;
+                if (ispoke == cobic<0>) {
                     auto next_lvl = lvl;
                     if (next_lvl.advance()) {
                         auto nxt_lvl_idx = next.get(next_lvl);
@@ -106,7 +109,6 @@ public:
                             return rslt;
                         }
                     }
-		    ispoke = cobic<0>;
                 }
             } while (ispoke != next.get(lvl));
         } while (lvl.advance());
@@ -117,20 +119,16 @@ public:
     template <class F> void process_expired(U elapsed, F f)
     {
         for (U i{ 0 }; i < elapsed; ++i) {
-            level lvl;
-            do {
+            cob_for<level>([&](auto lvl) {
                 auto ispoke = next.get(lvl);
                 for (auto const& id : timers[lvl.get()][ispoke.get()]) {
                     f(id);
                 }
                 timers[lvl.get()][ispoke.get()].clear();
 
-                if (ispoke.advance()) {
-                    next.set(lvl, ispoke);
-                    break;
-                }
-                next.set(lvl, cobic<0>);
-            } while (lvl.advance());
+                next.set(lvl, ++ispoke);
+                return ispoke == cobic<0>;
+            });
         }
     }
 
@@ -8,6 +8,7 @@
 
 
 #include "coblist.hpp"
+#include "cobmod.hpp"
 
 
 template <class ID, int N, class U, unsigned SPOKES> class cobtmrwheel {
@@ -31,8 +32,8 @@ template <class ID, int N, class U, unsigned SPOKES> class cobtmrwheel {
 
     using list   = cobtmrlist<ID, N / SPOKES * 2, U>;
     using ispoke = cobint<0, SPOKES - 1>;
-    list   timers[SPOKES];
-    ispoke next;
+    list           timers[SPOKES];
+    cobmod<SPOKES> next;
 
 public:
     using tmrID = ID;
@@ -44,9 +45,7 @@ public:
 
     index start(ID id, U duration)
     {
-        unsigned i = duration.count() % SPOKES;
-        ispoke   spoke;
-        spoke.be(i);
+        auto const spoke = cobmod<SPOKES>::wrap(duration.count());
         return { spoke, timers[spoke.get()].start(id, duration) };
     }
 
@@ -72,9 +71,7 @@ public:
             if (rslt) {
                 return rslt;
             }
-            if (!it.advance()) {
-                it = cobic<0>;
-            }
+            ++it;
         } while (it != next);
 
         return {};
@@ -84,9 +81,7 @@ public:
     {
         for (unsigned i = 0; i < elapsed.count(); ++i) {
             timers[next.get()].process_expired(U{ SPOKES }, f);
-            if (!next.advance()) {
-                next = cobic<0>;
-            }
+            ++next;
         }
     }
 